@@ -0,0 +1,196 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides common timing and reporting utilities for runtime benchmarks
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_BENCHMARKS_COMMON_BENCHMARK_H
+#define __SYCLCTS_BENCHMARKS_COMMON_BENCHMARK_H
+
+#include "../../tests/common/common.h"
+#include "../../tests/common/once_per_unit.h"
+
+#include <catch2/interfaces/catch_interfaces_config.hpp>
+#include <catch2/internal/catch_context.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sycl_cts::benchmark {
+
+using clock = std::chrono::steady_clock;
+
+/**
+ * @brief Summary of a series of timed samples. All durations are given in
+ *        nanoseconds.
+ */
+struct statistics {
+  std::size_t samples = 0;
+  double min = 0;
+  double median = 0;
+  double mean = 0;
+  double max = 0;
+};
+
+/**
+ * @brief Number of samples to take per measurement, as configured through
+ *        Catch2's `--benchmark-samples` option.
+ */
+inline std::size_t get_sample_count() {
+  const auto* config = Catch::getCurrentContext().getConfig();
+  return config != nullptr ? config->benchmarkSamples() : 100;
+}
+
+/**
+ * @brief Warm-up time before each measurement, as configured through Catch2's
+ *        `--benchmark-warmup-time` option.
+ */
+inline std::chrono::milliseconds get_warmup_time() {
+  const auto* config = Catch::getCurrentContext().getConfig();
+  return config != nullptr ? config->benchmarkWarmupTime()
+                           : std::chrono::milliseconds{100};
+}
+
+/**
+ * @brief Reduces a list of sample durations to their summary statistics
+ */
+inline statistics summarize(std::vector<double> samples) {
+  statistics stats;
+  if (samples.empty()) return stats;
+
+  std::sort(samples.begin(), samples.end());
+  const auto count = samples.size();
+  stats.samples = count;
+  stats.min = samples.front();
+  stats.max = samples.back();
+  stats.median = (count % 2 == 1)
+                     ? samples[count / 2]
+                     : (samples[count / 2 - 1] + samples[count / 2]) / 2;
+  stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / count;
+  return stats;
+}
+
+/**
+ * @brief Runs the given callable repeatedly and records the host wall-clock
+ *        time of each invocation
+ *
+ * The callable is first invoked until the configured warm-up time has elapsed
+ * (at least once) to exclude one-time costs like JIT compilation. It has to
+ * block until all work it started has completed.
+ */
+template <typename Func>
+statistics measure(Func&& func, std::size_t samples = get_sample_count()) {
+  const auto warmup_end = clock::now() + get_warmup_time();
+  do {
+    func();
+  } while (clock::now() < warmup_end);
+
+  std::vector<double> durations;
+  durations.reserve(samples);
+  for (std::size_t i = 0; i < samples; ++i) {
+    const auto start = clock::now();
+    func();
+    const auto end = clock::now();
+    durations.push_back(
+        std::chrono::duration<double, std::nano>(end - start).count());
+  }
+  return summarize(std::move(durations));
+}
+
+/**
+ * @brief Formats a duration given in nanoseconds using a readable unit
+ */
+inline std::string format_duration(double ns) {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(2);
+  if (ns < 1e3) {
+    out << ns << " ns";
+  } else if (ns < 1e6) {
+    out << ns / 1e3 << " us";
+  } else if (ns < 1e9) {
+    out << ns / 1e6 << " ms";
+  } else {
+    out << ns / 1e9 << " s";
+  }
+  return out.str();
+}
+
+/**
+ * @brief Formats a byte count using binary prefixes
+ */
+inline std::string format_bytes(std::size_t bytes) {
+  static const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  std::size_t unit = 0;
+  std::size_t value = bytes;
+  while (value >= 1024 && value % 1024 == 0 && unit < 4) {
+    value /= 1024;
+    ++unit;
+  }
+  return std::to_string(value) + " " + units[unit];
+}
+
+/**
+ * @brief Reports the latency statistics of a measurement
+ */
+inline void report(const std::string& name, const statistics& stats) {
+  WARN(name << ": median " << format_duration(stats.median) << ", mean "
+            << format_duration(stats.mean) << ", min "
+            << format_duration(stats.min) << ", max "
+            << format_duration(stats.max) << " (" << stats.samples
+            << " samples)");
+}
+
+/**
+ * @brief Reports the number of items processed per second, based on the
+ *        median sample duration
+ * @param items Number of items processed by a single sample
+ * @param unit Name of the processed items, e.g. "elements"
+ */
+inline void report_throughput(const std::string& name, const statistics& stats,
+                              double items, const std::string& unit) {
+  const double per_second = stats.median > 0 ? items / stats.median * 1e9 : 0;
+  WARN(name << ": " << std::scientific << std::setprecision(3) << per_second
+            << " " << unit << "/s (median " << format_duration(stats.median)
+            << " per " << items << " " << unit << ", " << stats.samples
+            << " samples)");
+}
+
+/**
+ * @brief Reports the bandwidth achieved for transferring the given number of
+ *        bytes, based on the median sample duration
+ */
+inline void report_bandwidth(const std::string& name, const statistics& stats,
+                             std::size_t bytes) {
+  const double gb_per_second = stats.median > 0 ? bytes / stats.median : 0;
+  WARN(name << " [" << format_bytes(bytes) << "]: " << std::fixed
+            << std::setprecision(3) << gb_per_second << " GB/s (median "
+            << format_duration(stats.median) << ", " << stats.samples
+            << " samples)");
+}
+
+}  // namespace sycl_cts::benchmark
+
+/**
+ * @brief Skips the current test case if benchmarks have been disabled through
+ *        Catch2's `--skip-benchmarks` option.
+ */
+#define SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED()                       \
+  do {                                                               \
+    const auto* cts_config = Catch::getCurrentContext().getConfig(); \
+    if (cts_config != nullptr && cts_config->skipBenchmarks()) {     \
+      SKIP("Benchmarks are disabled via --skip-benchmarks");         \
+    }                                                                \
+  } while (false)
+
+#endif  // __SYCLCTS_BENCHMARKS_COMMON_BENCHMARK_H
@@ -0,0 +1,108 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the bandwidth of handler::copy and USM memcpy
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace copy_bandwidth_benchmark {
+using namespace sycl_cts;
+
+/** Transfer sizes in bytes, from 4 KiB to 64 MiB */
+std::vector<std::size_t> get_sizes() {
+  std::vector<std::size_t> sizes;
+  for (std::size_t size = 4 * 1024; size <= 64 * 1024 * 1024; size *= 4) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+TEST_CASE("handler::copy bandwidth", "[benchmark][copy_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  for (const auto size : get_sizes()) {
+    std::vector<unsigned char> host(size, 1);
+    sycl::buffer<unsigned char> src{sycl::range<1>{size}};
+    sycl::buffer<unsigned char> dst{sycl::range<1>{size}};
+
+    const auto host_to_device = benchmark::measure([&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{src, cgh, sycl::write_only, sycl::no_init};
+        cgh.copy(host.data(), acc);
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report_bandwidth("handler::copy host to accessor",
+                                host_to_device, size);
+
+    const auto device_to_device = benchmark::measure([&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor in{src, cgh, sycl::read_only};
+        sycl::accessor out{dst, cgh, sycl::write_only, sycl::no_init};
+        cgh.copy(in, out);
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report_bandwidth("handler::copy accessor to accessor",
+                                device_to_device, size);
+
+    const auto device_to_host = benchmark::measure([&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{dst, cgh, sycl::read_only};
+        cgh.copy(acc, host.data());
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report_bandwidth("handler::copy accessor to host",
+                                device_to_host, size);
+  }
+}
+
+TEST_CASE("USM memcpy bandwidth", "[benchmark][copy_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  if (!device.has(sycl::aspect::usm_device_allocations) ||
+      !device.has(sycl::aspect::usm_host_allocations)) {
+    SKIP("Device does not support USM device and host allocations");
+  }
+
+  for (const auto size : get_sizes()) {
+    auto* host = sycl::malloc_host<unsigned char>(size, queue);
+    auto* dev_a = sycl::malloc_device<unsigned char>(size, queue);
+    auto* dev_b = sycl::malloc_device<unsigned char>(size, queue);
+    REQUIRE((host != nullptr && dev_a != nullptr && dev_b != nullptr));
+    queue.memset(host, 1, size).wait_and_throw();
+
+    const auto host_to_device =
+        benchmark::measure([&] { queue.memcpy(dev_a, host, size).wait(); });
+    benchmark::report_bandwidth("USM memcpy host to device", host_to_device,
+                                size);
+
+    const auto device_to_device =
+        benchmark::measure([&] { queue.memcpy(dev_b, dev_a, size).wait(); });
+    benchmark::report_bandwidth("USM memcpy device to device",
+                                device_to_device, size);
+
+    const auto device_to_host =
+        benchmark::measure([&] { queue.memcpy(host, dev_b, size).wait(); });
+    benchmark::report_bandwidth("USM memcpy device to host", device_to_host,
+                                size);
+
+    sycl::free(dev_b, queue);
+    sycl::free(dev_a, queue);
+    sycl::free(host, queue);
+  }
+}
+
+}  // namespace copy_bandwidth_benchmark
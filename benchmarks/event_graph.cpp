@@ -0,0 +1,180 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the scheduling overhead of dependency chains, fan-out/fan-in
+//  graphs and in-order and out-of-order queues
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace event_graph_benchmark {
+using namespace sycl_cts;
+
+class chain_kernel;
+class alternating_chain_kernel;
+class root_kernel;
+class branch_kernel;
+class sink_kernel;
+class independent_kernel;
+class in_order_chain_kernel;
+
+/** Graphs of at least this many commands use fewer samples */
+constexpr std::size_t large_graph_size = 1000;
+
+std::size_t get_samples(std::size_t commands) {
+  const auto samples = benchmark::get_sample_count();
+  return commands >= large_graph_size ? std::min<std::size_t>(samples, 10)
+                                      : samples;
+}
+
+/**
+ * @brief Submits a chain of empty kernels, each depending on the previous one
+ *        through handler::depends_on
+ * @return Event of the last command
+ */
+template <typename KernelName>
+sycl::event submit_chain(sycl::queue& queue, std::size_t length) {
+  sycl::event last;
+  for (std::size_t i = 0; i < length; ++i) {
+    last = queue.submit([&](sycl::handler& cgh) {
+      if (i > 0) cgh.depends_on(last);
+      cgh.single_task<KernelName>([] {});
+    });
+  }
+  return last;
+}
+
+TEST_CASE("dependency chain latency", "[benchmark][event_graph]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  for (const std::size_t length : {1, 10, 100, 1000, 10000}) {
+    const auto stats = benchmark::measure(
+        [&] { submit_chain<chain_kernel>(queue, length).wait_and_throw(); },
+        get_samples(length));
+    benchmark::report_throughput(
+        "chain of " + std::to_string(length) + " kernels via depends_on",
+        stats, static_cast<double>(length), "commands");
+  }
+
+  // Alternating kernels and host tasks cross between device and host
+  // scheduling for every dependency
+  for (const std::size_t length : {2, 10, 100, 1000}) {
+    const auto stats = benchmark::measure(
+        [&] {
+          sycl::event last;
+          for (std::size_t i = 0; i < length; ++i) {
+            last = queue.submit([&](sycl::handler& cgh) {
+              if (i > 0) cgh.depends_on(last);
+              if (i % 2 == 0) {
+                cgh.single_task<alternating_chain_kernel>([] {});
+              } else {
+                cgh.host_task([] {});
+              }
+            });
+          }
+          last.wait_and_throw();
+        },
+        get_samples(length));
+    benchmark::report_throughput("chain of " + std::to_string(length) +
+                                     " alternating kernels and host tasks",
+                                 stats, static_cast<double>(length),
+                                 "commands");
+  }
+}
+
+TEST_CASE("fan-out/fan-in graph latency", "[benchmark][event_graph]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  for (const std::size_t width : {2, 8, 64, 512}) {
+    const auto stats = benchmark::measure(
+        [&] {
+          auto root = queue.submit([](sycl::handler& cgh) {
+            cgh.single_task<root_kernel>([] {});
+          });
+          std::vector<sycl::event> branches;
+          branches.reserve(width);
+          for (std::size_t i = 0; i < width; ++i) {
+            branches.push_back(queue.submit([&](sycl::handler& cgh) {
+              cgh.depends_on(root);
+              cgh.single_task<branch_kernel>([] {});
+            }));
+          }
+          queue
+              .submit([&](sycl::handler& cgh) {
+                cgh.depends_on(branches);
+                cgh.single_task<sink_kernel>([] {});
+              })
+              .wait_and_throw();
+        },
+        get_samples(width));
+    benchmark::report("fan-out to " + std::to_string(width) +
+                          " kernels and fan-in",
+                      stats);
+  }
+}
+
+TEST_CASE("in-order vs. out-of-order queue throughput",
+          "[benchmark][event_graph]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& out_of_order = once_per_unit::get_queue();
+  sycl::queue in_order{out_of_order.get_context(), out_of_order.get_device(),
+                       sycl::property::queue::in_order{}};
+  constexpr std::size_t batch_size = 1000;
+
+  auto submit_independent = [&](sycl::queue& queue) {
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      queue.submit([](sycl::handler& cgh) {
+        cgh.single_task<independent_kernel>([] {});
+      });
+    }
+    queue.wait_and_throw();
+  };
+  benchmark::report_throughput(
+      "independent kernels on out-of-order queue",
+      benchmark::measure([&] { submit_independent(out_of_order); },
+                         get_samples(batch_size)),
+      batch_size, "commands");
+  benchmark::report_throughput(
+      "independent kernels on in-order queue",
+      benchmark::measure([&] { submit_independent(in_order); },
+                         get_samples(batch_size)),
+      batch_size, "commands");
+
+  // The same chain, ordered implicitly by the in-order queue
+  benchmark::report_throughput(
+      "kernel chain on out-of-order queue via depends_on",
+      benchmark::measure(
+          [&] {
+            submit_chain<chain_kernel>(out_of_order, batch_size)
+                .wait_and_throw();
+          },
+          get_samples(batch_size)),
+      batch_size, "commands");
+  benchmark::report_throughput(
+      "kernel chain on in-order queue",
+      benchmark::measure(
+          [&] {
+            for (std::size_t i = 0; i < batch_size; ++i) {
+              in_order.submit([](sycl::handler& cgh) {
+                cgh.single_task<in_order_chain_kernel>([] {});
+              });
+            }
+            in_order.wait_and_throw();
+          },
+          get_samples(batch_size)),
+      batch_size, "commands");
+}
+
+}  // namespace event_graph_benchmark
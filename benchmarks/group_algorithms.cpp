@@ -0,0 +1,485 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the cost per element of group algorithms across work-group sizes,
+//  sub-group sizes and element types
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+#include "../util/type_names.h"
+#include "catch2/catch_template_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace group_algorithms_benchmark {
+using namespace sycl_cts;
+
+template <typename AlgorithmT, typename T, std::size_t SubGroupSize>
+class group_kernel;
+template <typename AlgorithmT, typename T>
+class joint_kernel;
+
+/** Number of work-items of each launch */
+constexpr std::size_t global_size = std::size_t{1} << 20;
+
+/** Number of elements processed by each work-item of joint algorithms */
+constexpr std::size_t joint_elements_per_item = 4;
+
+/**
+ * Number of times each work-item applies the algorithm per launch, so the
+ * launch overhead doesn't dominate the measurement
+ */
+constexpr int iterations = 64;
+
+/**
+ * Work-group size of the launches of sub-group algorithms, if supported by the
+ * kernel
+ */
+constexpr std::size_t sub_group_benchmark_work_group_size = 256;
+
+/**
+ * Largest integer each element type represents exactly. Integer results which
+ * don't fit wrap around the same way on the host and on the device.
+ */
+template <typename T>
+inline constexpr std::size_t exact_max =
+    std::numeric_limits<std::size_t>::max();
+#if SYCL_CTS_ENABLE_HALF_TESTS
+template <>
+inline constexpr std::size_t exact_max<sycl::half> = std::size_t{1} << 11;
+#endif
+template <>
+inline constexpr std::size_t exact_max<float> = std::size_t{1} << 24;
+template <>
+inline constexpr std::size_t exact_max<double> = std::size_t{1} << 53;
+
+/**
+ * Sum over all iterations of a value `base + k * step`, where k is the
+ * iteration
+ */
+std::size_t sum_over_iterations(std::size_t base, std::size_t step) {
+  return base * iterations + step * (iterations * (iterations - 1) / 2);
+}
+
+/*
+ * Algorithms applied to a group or sub-group. In iteration k each work-item
+ * contributes the value 1 + k, so the result of each iteration is known.
+ */
+
+struct reduce_algorithm {
+  static constexpr const char* name = "reduce_over_group";
+  static constexpr bool has_work_group_scope = true;
+
+  template <typename GroupT, typename T>
+  static T apply(GroupT group, T value, int) {
+    return sycl::reduce_over_group(group, value, sycl::plus<T>{});
+  }
+
+  static std::size_t expected(std::size_t, std::size_t group_size) {
+    return sum_over_iterations(group_size, group_size);
+  }
+};
+
+struct inclusive_scan_algorithm {
+  static constexpr const char* name = "inclusive_scan_over_group";
+  static constexpr bool has_work_group_scope = true;
+
+  template <typename GroupT, typename T>
+  static T apply(GroupT group, T value, int) {
+    return sycl::inclusive_scan_over_group(group, value, sycl::plus<T>{});
+  }
+
+  static std::size_t expected(std::size_t local_id, std::size_t) {
+    return sum_over_iterations(local_id + 1, local_id + 1);
+  }
+};
+
+struct broadcast_algorithm {
+  static constexpr const char* name = "group_broadcast";
+  static constexpr bool has_work_group_scope = true;
+
+  template <typename GroupT, typename T>
+  static T apply(GroupT group, T value, int k) {
+    return sycl::group_broadcast(group, value,
+                                 k % group.get_local_linear_range());
+  }
+
+  static std::size_t expected(std::size_t, std::size_t) {
+    return sum_over_iterations(1, 1);
+  }
+};
+
+struct permute_by_xor_algorithm {
+  static constexpr const char* name = "permute_group_by_xor";
+  // Only defined for sub-groups
+  static constexpr bool has_work_group_scope = false;
+
+  template <typename GroupT, typename T>
+  static T apply(GroupT group, T value, int k) {
+    return sycl::permute_group_by_xor(group, value,
+                                      k % group.get_local_linear_range());
+  }
+
+  static std::size_t expected(std::size_t, std::size_t) {
+    return sum_over_iterations(1, 1);
+  }
+};
+
+/*
+ * Joint algorithms applied by a work-group to a segment of
+ * joint_elements_per_item elements per work-item, which are all 1
+ */
+
+struct joint_reduce_algorithm {
+  static constexpr const char* name = "joint_reduce";
+
+  template <typename T>
+  static T apply(sycl::group<1> group, const T* first, const T* last, T*,
+                 int k) {
+    return sycl::joint_reduce(group, first, last, T(k), sycl::plus<T>{});
+  }
+
+  static std::size_t expected(std::size_t, std::size_t segment_size) {
+    return sum_over_iterations(segment_size, 1);
+  }
+};
+
+struct joint_exclusive_scan_algorithm {
+  static constexpr const char* name = "joint_exclusive_scan";
+
+  template <typename T>
+  static T apply(sycl::group<1> group, const T* first, const T* last,
+                 T* result, int k) {
+    sycl::joint_exclusive_scan(group, first, last, result, T(k),
+                               sycl::plus<T>{});
+    // The result is overwritten by the next iteration
+    sycl::group_barrier(group);
+    const T value = result[group.get_local_linear_id()];
+    sycl::group_barrier(group);
+    return value;
+  }
+
+  static std::size_t expected(std::size_t local_id, std::size_t) {
+    return sum_over_iterations(local_id, 1);
+  }
+};
+
+/**
+ * @brief Maximum work-group size the kernel can be launched with on the device
+ *        of the queue. It can be lower than the maximum work-group size of the
+ *        device, e.g. for kernels requiring a sub-group size.
+ */
+template <typename KernelName>
+std::size_t get_max_work_group_size(const sycl::queue& queue) {
+  const auto device = queue.get_device();
+// AdaptiveCpp does not yet support sycl::get_kernel_bundle
+#if !SYCL_CTS_COMPILING_WITH_ADAPTIVECPP
+  const auto kernel_id = sycl::get_kernel_id<KernelName>();
+  const auto bundle = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+      queue.get_context(), {device}, {kernel_id});
+  return bundle.get_kernel(kernel_id)
+      .template get_info<sycl::info::kernel_device_specific::work_group_size>(
+          device);
+#else
+  return device.get_info<sycl::info::device::max_work_group_size>();
+#endif
+}
+
+/**
+ * @brief Work-group sizes dividing the global size, i.e. the powers of two from
+ *        1 up to max_size
+ */
+std::vector<std::size_t> get_work_group_sizes(std::size_t max_size) {
+  std::vector<std::size_t> sizes;
+  for (std::size_t size = 1; size <= max_size && size <= global_size;
+       size *= 2) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+/**
+ * @brief Reports the time per element and the device cycles per element,
+ *        i.e. the median duration of a launch converted to cycles at the
+ *        maximum clock frequency of the device and divided by the number of
+ *        elements processed by the whole launch. As all compute units process
+ *        elements at the same time, this is the throughput of the device, not
+ *        the cycles a single work-item spends on an element.
+ */
+void report_cycles(const std::string& name, const benchmark::statistics& stats,
+                   std::size_t elements, const sycl::device& device) {
+  const double clock_mhz =
+      device.get_info<sycl::info::device::max_clock_frequency>();
+  const double ns_per_element = stats.median / elements;
+  WARN(name << ": " << ns_per_element * clock_mhz * 1e-3
+            << " cycles/element at " << clock_mhz << " MHz ("
+            << benchmark::format_duration(ns_per_element) << "/element, median "
+            << benchmark::format_duration(stats.median) << ", "
+            << stats.samples << " samples)");
+}
+
+/**
+ * @brief Checks whether a result matches the exact expected value. Floating
+ *        point results which aren't exactly representable depend on the order
+ *        of the additions, so they aren't checked.
+ */
+template <typename T>
+bool matches(T result, std::size_t expected) {
+  if constexpr (std::is_integral_v<T>) {
+    return result == static_cast<T>(expected);
+  } else {
+    return expected > exact_max<T> ||
+           static_cast<double>(result) == static_cast<double>(expected);
+  }
+}
+
+/**
+ * @brief Checks the results of the first work-group
+ * @param expected Callable returning the exact expected result of a work-item
+ */
+template <typename T, typename ExpectedT>
+void check_results(sycl::buffer<T>& results, std::size_t work_group_size,
+                   ExpectedT expected) {
+  sycl::host_accessor acc{results, sycl::read_only};
+  for (std::size_t i = 0; i < work_group_size; ++i) {
+    if (!matches(acc[i], expected(i))) {
+      FAIL_CHECK("Unexpected result for work-item " << i);
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Measures an algorithm applied to work-groups of the given size, or if
+ *        SubGroupSize is not zero, to sub-groups of that size
+ */
+template <typename AlgorithmT, typename T, std::size_t SubGroupSize>
+void measure_group(sycl::queue& queue, sycl::buffer<T>& input,
+                   std::size_t work_group_size, const std::string& name) {
+  using kernel_name = group_kernel<AlgorithmT, T, SubGroupSize>;
+  sycl::buffer<T> results{sycl::range<1>{global_size}};
+  // The mapping of work-items to sub-groups is implementation-defined
+  sycl::buffer<std::size_t> local_ids{sycl::range<1>{global_size}};
+
+  auto submit = [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor in{input, cgh, sycl::read_only};
+      sycl::accessor out{results, cgh, sycl::write_only, sycl::no_init};
+      sycl::accessor ids{local_ids, cgh, sycl::write_only, sycl::no_init};
+      const sycl::nd_range<1> range{global_size, work_group_size};
+      auto body = [=](sycl::nd_item<1> item) {
+        const T value = in[item.get_global_id()];
+        T sum{0};
+        for (int k = 0; k < iterations; ++k) {
+          if constexpr (SubGroupSize == 0) {
+            sum += AlgorithmT::apply(item.get_group(), T(value + T(k)), k);
+          } else {
+            sum += AlgorithmT::apply(item.get_sub_group(), T(value + T(k)), k);
+          }
+        }
+        out[item.get_global_id()] = sum;
+        ids[item.get_global_id()] =
+            SubGroupSize == 0 ? item.get_local_linear_id()
+                              : item.get_sub_group().get_local_linear_id();
+      };
+      if constexpr (SubGroupSize == 0) {
+        cgh.parallel_for<kernel_name>(range, body);
+      } else {
+        cgh.parallel_for<kernel_name>(
+            range, [=](sycl::nd_item<1> item)
+                       [[sycl::reqd_sub_group_size(SubGroupSize)]] {
+                         body(item);
+                       });
+      }
+    });
+    queue.wait_and_throw();
+  };
+  report_cycles(name, benchmark::measure(submit), global_size * iterations,
+                queue.get_device());
+
+  const std::size_t group_size =
+      SubGroupSize == 0 ? work_group_size : SubGroupSize;
+  sycl::host_accessor ids{local_ids, sycl::read_only};
+  check_results(results, work_group_size, [&](std::size_t i) {
+    return AlgorithmT::expected(ids[i], group_size);
+  });
+}
+
+template <typename AlgorithmT, typename T>
+void measure_work_group_sizes(sycl::queue& queue, sycl::buffer<T>& input,
+                              const std::string& type_name) {
+  const std::size_t max_size =
+      get_max_work_group_size<group_kernel<AlgorithmT, T, 0>>(queue);
+  for (const auto size : get_work_group_sizes(max_size)) {
+    measure_group<AlgorithmT, T, 0>(
+        queue, input, size,
+        std::string{AlgorithmT::name} + "(group) of " + type_name +
+            " [work-group size " + std::to_string(size) + "]");
+  }
+}
+
+/**
+ * @brief Measures an algorithm applied to sub-groups of the given size, if the
+ *        device supports it. The work-group size is the largest power of two
+ *        up to sub_group_benchmark_work_group_size the kernel supports, so it
+ *        divides the global size.
+ */
+template <typename AlgorithmT, typename T, std::size_t SubGroupSize>
+void measure_sub_group_size(sycl::queue& queue, sycl::buffer<T>& input,
+                            const std::string& type_name) {
+  const auto device = queue.get_device();
+  const auto sizes = device.get_info<sycl::info::device::sub_group_sizes>();
+  if (std::find(sizes.begin(), sizes.end(), SubGroupSize) == sizes.end()) {
+    return;
+  }
+  const std::size_t max_size = std::min(
+      sub_group_benchmark_work_group_size,
+      get_max_work_group_size<group_kernel<AlgorithmT, T, SubGroupSize>>(
+          queue));
+  const auto candidates = get_work_group_sizes(max_size);
+  const std::size_t work_group_size = candidates.back();
+  if (work_group_size < SubGroupSize) return;
+
+  measure_group<AlgorithmT, T, SubGroupSize>(
+      queue, input, work_group_size,
+      std::string{AlgorithmT::name} + "(sub_group) of " + type_name +
+          " [sub-group size " + std::to_string(SubGroupSize) +
+          ", work-group size " + std::to_string(work_group_size) + "]");
+}
+
+template <typename AlgorithmT, typename T>
+void measure_algorithm(sycl::queue& queue, const std::string& type_name) {
+  sycl::buffer<T> input{sycl::range<1>{global_size}};
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{input, cgh, sycl::write_only, sycl::no_init};
+    cgh.fill(acc, T{1});
+  });
+
+  if constexpr (AlgorithmT::has_work_group_scope) {
+    measure_work_group_sizes<AlgorithmT, T>(queue, input, type_name);
+  }
+  measure_sub_group_size<AlgorithmT, T, 4>(queue, input, type_name);
+  measure_sub_group_size<AlgorithmT, T, 8>(queue, input, type_name);
+  measure_sub_group_size<AlgorithmT, T, 16>(queue, input, type_name);
+  measure_sub_group_size<AlgorithmT, T, 32>(queue, input, type_name);
+  measure_sub_group_size<AlgorithmT, T, 64>(queue, input, type_name);
+}
+
+/**
+ * @brief Measures a joint algorithm for every work-group size, each work-group
+ *        processing joint_elements_per_item elements per work-item
+ */
+template <typename AlgorithmT, typename T>
+void measure_joint_algorithm(sycl::queue& queue, const std::string& type_name) {
+  constexpr std::size_t size = global_size * joint_elements_per_item;
+  sycl::buffer<T> input{sycl::range<1>{size}};
+  sycl::buffer<T> scratch{sycl::range<1>{size}};
+  sycl::buffer<T> results{sycl::range<1>{global_size}};
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{input, cgh, sycl::write_only, sycl::no_init};
+    cgh.fill(acc, T{1});
+  });
+
+  const std::size_t max_size =
+      get_max_work_group_size<joint_kernel<AlgorithmT, T>>(queue);
+  for (const auto work_group_size : get_work_group_sizes(max_size)) {
+    const std::size_t segment_size = work_group_size * joint_elements_per_item;
+    auto submit = [&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor in{input, cgh, sycl::read_only};
+        sycl::accessor tmp{scratch, cgh, sycl::read_write};
+        sycl::accessor out{results, cgh, sycl::write_only, sycl::no_init};
+        cgh.parallel_for<joint_kernel<AlgorithmT, T>>(
+            sycl::nd_range<1>{global_size, work_group_size},
+            [=](sycl::nd_item<1> item) {
+              const auto group = item.get_group();
+              const std::size_t offset =
+                  group.get_group_linear_id() * segment_size;
+              const T* first =
+                  in.template get_multi_ptr<sycl::access::decorated::no>()
+                      .get() +
+                  offset;
+              T* result =
+                  tmp.template get_multi_ptr<sycl::access::decorated::no>()
+                      .get() +
+                  offset;
+              T sum{0};
+              for (int k = 0; k < iterations; ++k) {
+                sum += AlgorithmT::apply(group, first, first + segment_size,
+                                         result, k);
+              }
+              out[item.get_global_id()] = sum;
+            });
+      });
+      queue.wait_and_throw();
+    };
+    report_cycles(std::string{AlgorithmT::name} + " of " + type_name +
+                      " [work-group size " + std::to_string(work_group_size) +
+                      ", " + std::to_string(segment_size) +
+                      " elements per work-group]",
+                  benchmark::measure(submit), size * iterations,
+                  queue.get_device());
+
+    check_results(results, work_group_size, [&](std::size_t i) {
+      return AlgorithmT::expected(i, segment_size);
+    });
+  }
+}
+
+template <typename T>
+void measure_all(sycl::queue& queue, const std::string& type_name) {
+  measure_algorithm<reduce_algorithm, T>(queue, type_name);
+  measure_algorithm<inclusive_scan_algorithm, T>(queue, type_name);
+  measure_algorithm<broadcast_algorithm, T>(queue, type_name);
+  measure_algorithm<permute_by_xor_algorithm, T>(queue, type_name);
+  measure_joint_algorithm<joint_reduce_algorithm, T>(queue, type_name);
+  measure_joint_algorithm<joint_exclusive_scan_algorithm, T>(queue,
+                                                             type_name);
+}
+
+TEMPLATE_TEST_CASE("group algorithm cost per element",
+                   "[benchmark][group_algorithms]", std::int8_t, std::uint8_t,
+                   std::int16_t, std::uint16_t, std::int32_t, std::uint32_t,
+                   std::int64_t, std::uint64_t, float) {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  measure_all<TestType>(once_per_unit::get_queue(), type_name<TestType>());
+}
+
+#if SYCL_CTS_ENABLE_HALF_TESTS
+TEST_CASE("group algorithm cost per element. half",
+          "[benchmark][group_algorithms][fp16]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations.");
+  }
+  measure_all<sycl::half>(queue, "half");
+}
+#endif
+
+#if SYCL_CTS_ENABLE_DOUBLE_TESTS
+TEST_CASE("group algorithm cost per element. double",
+          "[benchmark][group_algorithms][fp64]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp64)) {
+    SKIP("Device does not support double precision floating point "
+         "operations.");
+  }
+  measure_all<double>(queue, "double");
+}
+#endif
+
+}  // namespace group_algorithms_benchmark
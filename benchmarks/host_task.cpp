@@ -0,0 +1,69 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the dispatch latency of host tasks
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+namespace host_task_benchmark {
+using namespace sycl_cts;
+
+class producer_kernel;
+class round_trip_producer_kernel;
+class round_trip_consumer_kernel;
+
+TEST_CASE("host_task dispatch latency", "[benchmark][host_task]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  SECTION("independent host_task") {
+    const auto stats = benchmark::measure([&] {
+      queue.submit([](sycl::handler& cgh) { cgh.host_task([] {}); });
+      queue.wait_and_throw();
+    });
+    benchmark::report("host_task submit + wait", stats);
+  }
+
+  SECTION("host_task depending on a kernel") {
+    sycl::buffer<int> buffer{sycl::range<1>{1}};
+    const auto stats = benchmark::measure([&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{buffer, cgh, sycl::write_only, sycl::no_init};
+        cgh.single_task<producer_kernel>([=] { acc[0] = 1; });
+      });
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{buffer, cgh, sycl::read_write_host_task};
+        cgh.host_task([=] { acc[0] += 1; });
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report("kernel -> host_task round trip", stats);
+  }
+
+  SECTION("kernel -> host_task -> kernel through events") {
+    const auto stats = benchmark::measure([&] {
+      auto producer = queue.submit([](sycl::handler& cgh) {
+        cgh.single_task<round_trip_producer_kernel>([] {});
+      });
+      auto host = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(producer);
+        cgh.host_task([] {});
+      });
+      queue
+          .submit([&](sycl::handler& cgh) {
+            cgh.depends_on(host);
+            cgh.single_task<round_trip_consumer_kernel>([] {});
+          })
+          .wait_and_throw();
+    });
+    benchmark::report("kernel -> host_task -> kernel round trip", stats);
+  }
+}
+
+}  // namespace host_task_benchmark
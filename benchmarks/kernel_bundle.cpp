@@ -0,0 +1,202 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the JIT latency of kernel bundles and whether the implementation
+//  caches compiled device images
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kernel_bundle_benchmark {
+using namespace sycl_cts;
+
+class bundle_kernel;
+class submit_kernel;
+class build_kernel;
+class spec_const_kernel;
+
+constexpr sycl::specialization_id<int> spec_value(1);
+
+/** JIT compilations are expensive, so fewer samples are taken of them */
+constexpr std::size_t max_compile_samples = 20;
+
+/**
+ * @brief Host wall-clock time of a single invocation of the given callable in
+ *        nanoseconds
+ */
+template <typename Func>
+double time_once(Func&& func) {
+  const auto start = benchmark::clock::now();
+  func();
+  const auto end = benchmark::clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+std::size_t get_compile_samples() {
+  return std::min(benchmark::get_sample_count(), max_compile_samples);
+}
+
+/**
+ * @brief Reports the latency of the first request and of repeated requests
+ *
+ * Only the first request can include a compilation. Implementations may
+ * compile all kernels of a device image at once, so the first request is only
+ * cold if no other test case of this executable ran before it.
+ */
+void report_first_and_repeated(const std::string& name, double first,
+                               const benchmark::statistics& repeated) {
+  benchmark::report(name + ", first request", benchmark::summarize({first}));
+  benchmark::report(name + ", repeated requests", repeated);
+}
+
+void require_online_compiler(const sycl::device& device) {
+  if (!device.has(sycl::aspect::online_compiler)) {
+    SKIP("Device does not support online compilation");
+  }
+}
+
+template <typename KernelName>
+auto get_input_bundle(const sycl::context& context,
+                      const sycl::device& device) {
+  auto bundle = sycl::get_kernel_bundle<KernelName, sycl::bundle_state::input>(
+      context, {device});
+  if (!bundle.has_kernel(sycl::get_kernel_id<KernelName>())) {
+    SKIP("kernel_bundle doesn't have required kernel. Test is skipped.");
+  }
+  return bundle;
+}
+
+TEST_CASE("get_kernel_bundle latency", "[benchmark][kernel_bundle]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto context = queue.get_context();
+  const auto device = queue.get_device();
+  auto get_bundle = [&] {
+    return sycl::get_kernel_bundle<bundle_kernel,
+                                   sycl::bundle_state::executable>(context,
+                                                                   {device});
+  };
+
+  const auto first = time_once(get_bundle);
+  report_first_and_repeated("get_kernel_bundle<executable>", first,
+                            benchmark::measure(get_bundle));
+
+  queue.submit([&](sycl::handler& cgh) {
+    cgh.use_kernel_bundle(get_bundle());
+    cgh.single_task<bundle_kernel>([] {});
+  });
+  queue.wait_and_throw();
+}
+
+TEST_CASE("kernel_bundle build latency", "[benchmark][kernel_bundle]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  require_online_compiler(device);
+  const auto input = get_input_bundle<build_kernel>(queue.get_context(), device);
+
+  const auto first = time_once([&] { sycl::build(input); });
+  report_first_and_repeated(
+      "build of the same input bundle", first,
+      benchmark::measure([&] { sycl::build(input); }, get_compile_samples()));
+
+  const auto executable = sycl::build(input);
+  queue.submit([&](sycl::handler& cgh) {
+    cgh.use_kernel_bundle(executable);
+    cgh.single_task<build_kernel>([] {});
+  });
+  queue.wait_and_throw();
+}
+
+/**
+ * @brief Runs the kernel of the given bundle and checks the value of its
+ *        specialization constant
+ */
+void check_spec_const(sycl::queue& queue,
+                      const sycl::kernel_bundle<sycl::bundle_state::executable>&
+                          executable,
+                      int expected) {
+  sycl::buffer<int> result{sycl::range<1>{1}};
+  queue.submit([&](sycl::handler& cgh) {
+    cgh.use_kernel_bundle(executable);
+    sycl::accessor acc{result, cgh, sycl::write_only, sycl::no_init};
+    cgh.single_task<spec_const_kernel>([=](sycl::kernel_handler h) {
+      acc[0] = h.get_specialization_constant<spec_value>();
+    });
+  });
+  sycl::host_accessor acc{result, sycl::read_only};
+  CHECK(acc[0] == expected);
+}
+
+TEST_CASE("kernel_bundle specialization constant rebuild latency",
+          "[benchmark][kernel_bundle]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  require_online_compiler(device);
+  auto input = get_input_bundle<spec_const_kernel>(queue.get_context(), device);
+
+  // Every build with a new value requires a new compilation, unless the
+  // implementation supports native specialization constants
+  int value = 1;
+  std::vector<double> durations;
+  for (std::size_t i = 0; i < get_compile_samples(); ++i) {
+    input.set_specialization_constant<spec_value>(++value);
+    durations.push_back(time_once([&] { sycl::build(input); }));
+  }
+  const auto distinct = benchmark::summarize(std::move(durations));
+
+  // Rebuilding with a value that has already been built may reuse the image
+  const auto repeated =
+      benchmark::measure([&] { sycl::build(input); }, get_compile_samples());
+  WARN("Specialization constants are "
+       << (input.native_specialization_constant() ? "" : "not ")
+       << "native on this device");
+  benchmark::report("build after set_specialization_constant, new values",
+                    distinct);
+  benchmark::report(
+      "build after set_specialization_constant, already built value",
+      repeated);
+
+  check_spec_const(queue, sycl::build(input), value);
+}
+
+TEST_CASE("first submit latency", "[benchmark][kernel_bundle]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  auto submit = [&] {
+    queue.submit(
+        [](sycl::handler& cgh) { cgh.single_task<submit_kernel>([] {}); });
+    queue.wait_and_throw();
+  };
+
+  const auto first = time_once(submit);
+  report_first_and_repeated("kernel submit + wait", first,
+                            benchmark::measure(submit));
+
+  const auto executable =
+      sycl::get_kernel_bundle<submit_kernel, sycl::bundle_state::executable>(
+          queue.get_context(), {queue.get_device()});
+  benchmark::report("kernel submit + wait using an executable bundle",
+                    benchmark::measure([&] {
+                      queue.submit([&](sycl::handler& cgh) {
+                        cgh.use_kernel_bundle(executable);
+                        cgh.single_task<submit_kernel>([] {});
+                      });
+                      queue.wait_and_throw();
+                    }));
+}
+
+}  // namespace kernel_bundle_benchmark
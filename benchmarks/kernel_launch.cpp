@@ -0,0 +1,77 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the latency and throughput of launching empty kernels
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+namespace kernel_launch_benchmark {
+using namespace sycl_cts;
+
+class empty_single_task;
+class empty_parallel_for;
+class empty_nd_range;
+class batched_single_task;
+
+TEST_CASE("kernel launch latency", "[benchmark][kernel_launch]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  SECTION("single_task") {
+    const auto stats = benchmark::measure([&] {
+      queue.submit([](sycl::handler& cgh) {
+        cgh.single_task<empty_single_task>([] {});
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report("single_task submit + wait", stats);
+  }
+
+  SECTION("parallel_for over range") {
+    const auto stats = benchmark::measure([&] {
+      queue.submit([](sycl::handler& cgh) {
+        cgh.parallel_for<empty_parallel_for>(sycl::range<1>{1},
+                                             [](sycl::item<1>) {});
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report("parallel_for(range) submit + wait", stats);
+  }
+
+  SECTION("parallel_for over nd_range") {
+    const auto stats = benchmark::measure([&] {
+      queue.submit([](sycl::handler& cgh) {
+        cgh.parallel_for<empty_nd_range>(
+            sycl::nd_range<1>{sycl::range<1>{1}, sycl::range<1>{1}},
+            [](sycl::nd_item<1>) {});
+      });
+      queue.wait_and_throw();
+    });
+    benchmark::report("parallel_for(nd_range) submit + wait", stats);
+  }
+}
+
+TEST_CASE("kernel launch throughput", "[benchmark][kernel_launch]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  constexpr std::size_t batch_size = 1000;
+
+  const auto stats = benchmark::measure([&] {
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      queue.submit([](sycl::handler& cgh) {
+        cgh.single_task<batched_single_task>([] {});
+      });
+    }
+    queue.wait_and_throw();
+  });
+  benchmark::report_throughput("batched single_task", stats, batch_size,
+                               "launches");
+}
+
+}  // namespace kernel_launch_benchmark
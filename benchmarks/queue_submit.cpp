@@ -0,0 +1,68 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the host-side overhead of queue::submit
+//
+*******************************************************************************/
+
+#include "common/benchmark.h"
+
+#include <vector>
+
+namespace queue_submit_benchmark {
+using namespace sycl_cts;
+
+class submit_kernel;
+class submit_accessor_kernel;
+
+/**
+ * @brief Measures only the time spent inside queue::submit, the completion of
+ *        the submitted command groups is awaited outside of the timed region.
+ */
+template <typename CommandGroupT>
+benchmark::statistics measure_submit(sycl::queue& queue, CommandGroupT cgf) {
+  const auto samples = benchmark::get_sample_count();
+  std::vector<double> durations;
+  durations.reserve(samples);
+
+  // Warm-up to exclude JIT compilation and lazy runtime initialization
+  queue.submit(cgf);
+  queue.wait_and_throw();
+
+  for (std::size_t i = 0; i < samples; ++i) {
+    const auto start = benchmark::clock::now();
+    queue.submit(cgf);
+    const auto end = benchmark::clock::now();
+    durations.push_back(
+        std::chrono::duration<double, std::nano>(end - start).count());
+  }
+  queue.wait_and_throw();
+  return benchmark::summarize(std::move(durations));
+}
+
+TEST_CASE("queue::submit overhead", "[benchmark][queue_submit]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+
+  SECTION("command group without requirements") {
+    const auto stats = measure_submit(queue, [](sycl::handler& cgh) {
+      cgh.single_task<submit_kernel>([] {});
+    });
+    benchmark::report("submit without requirements", stats);
+  }
+
+  SECTION("command group with a buffer accessor") {
+    sycl::buffer<int> buffer{sycl::range<1>{1}};
+    const auto stats = measure_submit(queue, [&](sycl::handler& cgh) {
+      sycl::accessor acc{buffer, cgh, sycl::read_write};
+      cgh.single_task<submit_accessor_kernel>([=] { acc[0] += 1; });
+    });
+    benchmark::report("submit with accessor", stats);
+  }
+}
+
+}  // namespace queue_submit_benchmark
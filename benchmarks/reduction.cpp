@@ -0,0 +1,220 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the throughput of sycl::reduction across operators, types, input
+//  sizes, launch shapes and the number of reductions per kernel
+//
+*******************************************************************************/
+
+#include "../tests/common/disabled_for_test_case.h"
+#include "common/benchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace reduction_benchmark {
+using namespace sycl_cts;
+
+template <typename T, typename OpT, std::size_t Reductions, bool UseNdRange>
+class reduction_kernel;
+
+/** Input sizes are limited to 2^28 elements */
+constexpr std::size_t max_log2_size = 28;
+
+/**
+ * @brief Input sizes in elements, from 2^20 up to 2^28, limited by the maximum
+ *        allocation size and a quarter of the global memory of the device
+ *
+ * Floating point sums of ones are only exact, and therefore independent of the
+ * unspecified order of the additions, as long as all partial sums are
+ * representable. Sums are limited to 2^digits elements, e.g. 2^24 for float,
+ * as an implementation combining sequentially would otherwise saturate.
+ */
+template <typename T, typename OpT>
+std::vector<std::size_t> get_sizes(const sycl::queue& queue) {
+  const auto device = queue.get_device();
+  std::size_t limit =
+      std::min<std::size_t>(
+          device.get_info<sycl::info::device::max_mem_alloc_size>(),
+          device.get_info<sycl::info::device::global_mem_size>() / 4) /
+      sizeof(T);
+  if constexpr (std::is_floating_point_v<T> &&
+                std::is_same_v<OpT, sycl::plus<T>>) {
+    constexpr int digits = std::numeric_limits<T>::digits;
+    if (digits < 64) {
+      limit = std::min(limit, std::size_t{1} << digits);
+    }
+  }
+  std::vector<std::size_t> sizes;
+  for (std::size_t log2_size = 20; log2_size <= max_log2_size;
+       log2_size += 4) {
+    const std::size_t size = std::size_t{1} << log2_size;
+    if (size <= limit) sizes.push_back(size);
+  }
+  return sizes;
+}
+
+/**
+ * @brief Work-group sizes of the nd_range launches, limited by the device
+ */
+std::vector<std::size_t> get_work_group_sizes(const sycl::queue& queue) {
+  const std::size_t max_size =
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+  std::vector<std::size_t> sizes;
+  for (const std::size_t size : {64, 256, 1024}) {
+    if (size <= max_size) sizes.push_back(size);
+  }
+  if (sizes.empty()) sizes.push_back(max_size);
+  return sizes;
+}
+
+/**
+ * @brief Expected result of reducing `size` elements with value 1, which is
+ *        exact for all sizes returned by get_sizes
+ */
+template <typename T, typename OpT>
+T get_expected(std::size_t size) {
+  if constexpr (std::is_same_v<OpT, sycl::plus<T>>) {
+    return static_cast<T>(size);
+  } else if constexpr (std::is_same_v<OpT, sycl::bit_xor<T>>) {
+    return static_cast<T>(size % 2);
+  } else {
+    return T{1};
+  }
+}
+
+/**
+ * @brief Runs `Reductions` reductions with the same operator over the input in
+ *        a single kernel, either as range or as nd_range launch
+ */
+template <typename T, typename OpT, bool UseNdRange, std::size_t... I>
+void measure(sycl::queue& queue, sycl::buffer<T>& input, std::size_t size,
+             std::size_t work_group_size, const std::string& name,
+             std::index_sequence<I...>) {
+  constexpr std::size_t reductions = sizeof...(I);
+  using kernel_name = reduction_kernel<T, OpT, reductions, UseNdRange>;
+  std::array<sycl::buffer<T>, reductions> results{
+      ((void)I, sycl::buffer<T>{sycl::range<1>{1}})...};
+
+  auto submit = [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor in{input, cgh, sycl::read_only};
+      const auto property =
+          sycl::property::reduction::initialize_to_identity{};
+      if constexpr (UseNdRange) {
+        cgh.parallel_for<kernel_name>(
+            sycl::nd_range<1>{size, work_group_size},
+            sycl::reduction(results[I], cgh, OpT{}, property)...,
+            [=](sycl::nd_item<1> item, auto&... reducers) {
+              const T value = in[item.get_global_id()];
+              (reducers.combine(value), ...);
+            });
+      } else {
+        cgh.parallel_for<kernel_name>(
+            sycl::range<1>{size},
+            sycl::reduction(results[I], cgh, OpT{}, property)...,
+            [=](sycl::id<1> idx, auto&... reducers) {
+              const T value = in[idx];
+              (reducers.combine(value), ...);
+            });
+      }
+    });
+    queue.wait_and_throw();
+  };
+
+  const auto samples = size >= (std::size_t{1} << 24)
+                           ? std::min<std::size_t>(
+                                 benchmark::get_sample_count(), 10)
+                           : benchmark::get_sample_count();
+  const auto stats = benchmark::measure(submit, samples);
+  benchmark::report_throughput(name, stats, static_cast<double>(size),
+                               "elements");
+
+  const T expected = get_expected<T, OpT>(size);
+  for (auto& result : results) {
+    sycl::host_accessor acc{result, sycl::read_only};
+    CHECK(acc[0] == expected);
+  }
+}
+
+/**
+ * @brief Measures a reduction operator for all input sizes, launch shapes and
+ *        1, 2 and 4 concurrent reductions
+ */
+template <typename T, typename OpT>
+void measure_operator(sycl::queue& queue, const std::string& type_name,
+                      const std::string& op_name) {
+  for (const auto size : get_sizes<T, OpT>(queue)) {
+    sycl::buffer<T> input{sycl::range<1>{size}};
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{input, cgh, sycl::write_only, sycl::no_init};
+      cgh.fill(acc, T{1});
+    });
+
+    const auto base_name = op_name + " reduction of " + type_name + " [2^" +
+                           std::to_string(static_cast<int>(std::log2(size))) +
+                           " elements";
+    auto run = [&](auto reductions) {
+      const auto name = base_name + ", " +
+                        std::to_string(reductions.size()) + " reduction" +
+                        (reductions.size() > 1 ? "s" : "");
+      measure<T, OpT, false>(queue, input, size, 0, name + ", range]",
+                             reductions);
+      for (const auto work_group_size : get_work_group_sizes(queue)) {
+        if (size % work_group_size != 0) continue;
+        measure<T, OpT, true>(queue, input, size, work_group_size,
+                              name + ", nd_range with work-group size " +
+                                  std::to_string(work_group_size) + "]",
+                              reductions);
+      }
+    };
+    run(std::make_index_sequence<1>{});
+    run(std::make_index_sequence<2>{});
+    run(std::make_index_sequence<4>{});
+  }
+}
+
+template <typename T>
+void measure_arithmetic_operators(sycl::queue& queue,
+                                  const std::string& type_name) {
+  measure_operator<T, sycl::plus<T>>(queue, type_name, "plus");
+  measure_operator<T, sycl::multiplies<T>>(queue, type_name, "multiplies");
+  measure_operator<T, sycl::minimum<T>>(queue, type_name, "minimum");
+  measure_operator<T, sycl::maximum<T>>(queue, type_name, "maximum");
+}
+
+template <typename T>
+void measure_bitwise_operators(sycl::queue& queue,
+                               const std::string& type_name) {
+  measure_operator<T, sycl::bit_and<T>>(queue, type_name, "bit_and");
+  measure_operator<T, sycl::bit_or<T>>(queue, type_name, "bit_or");
+  measure_operator<T, sycl::bit_xor<T>>(queue, type_name, "bit_xor");
+}
+
+// FIXME: re-enable when sycl::reduction is implemented in AdaptiveCpp
+DISABLED_FOR_TEST_CASE(AdaptiveCpp)
+("reduction throughput. int32", "[benchmark][reduction]")({
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  measure_arithmetic_operators<std::int32_t>(queue, "int32");
+  measure_bitwise_operators<std::int32_t>(queue, "int32");
+});
+
+DISABLED_FOR_TEST_CASE(AdaptiveCpp)
+("reduction throughput. float", "[benchmark][reduction]")({
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  measure_arithmetic_operators<float>(queue, "float");
+});
+
+}  // namespace reduction_benchmark
@@ -0,0 +1,211 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the submission throughput of kernels and USM operations on default
+//  and in-order queues, using queue::submit, queue shortcut functions and the
+//  khr_free_function_commands extension
+//
+*******************************************************************************/
+
+#include "../util/usm_helper.h"
+#include "common/benchmark.h"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace submission_throughput_benchmark {
+using namespace sycl_cts;
+
+/** Ways of submitting a command */
+enum class method { submit, shortcut, khr };
+
+template <method M>
+class empty_kernel;
+template <method M>
+class small_kernel;
+
+/** Number of commands submitted before waiting for their completion */
+constexpr std::size_t batch_size = 1000;
+
+/** Number of work-items of the small kernel */
+constexpr std::size_t small_kernel_size = 256;
+
+/** Number of bytes copied by each memcpy */
+constexpr std::size_t memcpy_size = 64;
+
+template <method M>
+std::string get_method_description() {
+  if constexpr (M == method::submit) {
+    return "queue::submit";
+  } else if constexpr (M == method::shortcut) {
+    return "queue shortcut";
+  } else {
+    return "khr free function";
+  }
+}
+
+/**
+ * @brief Submits batches of commands and reports the number of submissions per
+ *        second, including the time to wait for their completion
+ */
+template <method M, typename SubmitT>
+void measure(sycl::queue& queue, const std::string& queue_description,
+             const std::string& command_description, SubmitT submit) {
+  const auto stats = benchmark::measure([&] {
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      submit(queue);
+    }
+    queue.wait_and_throw();
+  });
+  benchmark::report_throughput(command_description + " via " +
+                                   get_method_description<M>() + " on " +
+                                   queue_description,
+                               stats, batch_size, "submissions");
+}
+
+template <method M>
+void submit_empty_kernel(sycl::queue& queue) {
+  if constexpr (M == method::submit) {
+    queue.submit([](sycl::handler& cgh) {
+      cgh.single_task<empty_kernel<M>>([] {});
+    });
+  } else if constexpr (M == method::shortcut) {
+    queue.single_task<empty_kernel<M>>([] {});
+#ifdef SYCL_KHR_FREE_FUNCTION_COMMANDS
+  } else if constexpr (M == method::khr) {
+    sycl::khr::launch_task<empty_kernel<M>>(queue, [] {});
+#endif
+  }
+}
+
+template <method M>
+void submit_small_kernel(sycl::queue& queue, int* data) {
+  const sycl::range<1> range{small_kernel_size};
+  auto kernel = [=](sycl::item<1> item) {
+    data[item.get_id()] = static_cast<int>(item.get_linear_id());
+  };
+  if constexpr (M == method::submit) {
+    queue.submit([&](sycl::handler& cgh) {
+      cgh.parallel_for<small_kernel<M>>(range, kernel);
+    });
+  } else if constexpr (M == method::shortcut) {
+    queue.parallel_for<small_kernel<M>>(range, kernel);
+#ifdef SYCL_KHR_FREE_FUNCTION_COMMANDS
+  } else if constexpr (M == method::khr) {
+    sycl::khr::launch<small_kernel<M>>(queue, range, kernel);
+#endif
+  }
+}
+
+template <method M>
+void submit_memcpy(sycl::queue& queue, void* destination, const void* source) {
+  if constexpr (M == method::submit) {
+    queue.submit([&](sycl::handler& cgh) {
+      cgh.memcpy(destination, source, memcpy_size);
+    });
+  } else if constexpr (M == method::shortcut) {
+    queue.memcpy(destination, source, memcpy_size);
+#ifdef SYCL_KHR_FREE_FUNCTION_COMMANDS
+  } else if constexpr (M == method::khr) {
+    sycl::khr::memcpy(queue, destination, source, memcpy_size);
+#endif
+  }
+}
+
+/**
+ * @brief Calls the given generic callable with every submission method
+ *        available, passing the method as std::integral_constant
+ */
+template <typename ActionT>
+void for_each_method(ActionT action) {
+  action(std::integral_constant<method, method::submit>{});
+  action(std::integral_constant<method, method::shortcut>{});
+#ifdef SYCL_KHR_FREE_FUNCTION_COMMANDS
+  action(std::integral_constant<method, method::khr>{});
+#else
+  WARN("khr_free_function_commands is not supported, skipping its methods");
+#endif
+}
+
+/**
+ * @brief Calls the given callable with the default queue and an in-order queue
+ *        for the same device
+ */
+template <typename ActionT>
+void for_each_queue(ActionT action) {
+  auto& queue = once_per_unit::get_queue();
+  sycl::queue in_order{queue.get_context(), queue.get_device(),
+                       sycl::property::queue::in_order{}};
+  action(queue, "default queue");
+  action(in_order, "in-order queue");
+}
+
+TEST_CASE("empty kernel submission throughput",
+          "[benchmark][submission_throughput]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  for_each_queue([](sycl::queue& queue, const std::string& description) {
+    for_each_method([&](auto m) {
+      constexpr method M = decltype(m)::value;
+      measure<M>(queue, description, "empty single_task",
+                 [](sycl::queue& q) { submit_empty_kernel<M>(q); });
+    });
+  });
+}
+
+TEST_CASE("small kernel submission throughput",
+          "[benchmark][submission_throughput]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+  const auto data = usm_helper::allocate_usm_memory<sycl::usm::alloc::device,
+                                                    int>(queue,
+                                                         small_kernel_size);
+  queue.memset(data.get(), 0, small_kernel_size * sizeof(int))
+      .wait_and_throw();
+  auto* ptr = data.get();
+
+  for_each_queue([&](sycl::queue& target, const std::string& description) {
+    for_each_method([&](auto m) {
+      constexpr method M = decltype(m)::value;
+      measure<M>(target, description,
+                 "parallel_for over " + std::to_string(small_kernel_size) +
+                     " work-items",
+                 [&](sycl::queue& q) { submit_small_kernel<M>(q, ptr); });
+    });
+  });
+}
+
+TEST_CASE("USM memcpy submission throughput",
+          "[benchmark][submission_throughput]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+  const auto source =
+      usm_helper::allocate_usm_memory<sycl::usm::alloc::device, char>(
+          queue, memcpy_size);
+  const auto destination =
+      usm_helper::allocate_usm_memory<sycl::usm::alloc::device, char>(
+          queue, memcpy_size);
+
+  for_each_queue([&](sycl::queue& target, const std::string& description) {
+    for_each_method([&](auto m) {
+      constexpr method M = decltype(m)::value;
+      measure<M>(target, description,
+                 std::to_string(memcpy_size) + " B device to device memcpy",
+                 [&](sycl::queue& q) {
+                   submit_memcpy<M>(q, destination.get(), source.get());
+                 });
+    });
+  });
+}
+
+}  // namespace submission_throughput_benchmark
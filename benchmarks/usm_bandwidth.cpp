@@ -0,0 +1,250 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the bandwidth and latency of USM memcpy, fill and memset across
+//  allocation kinds
+//
+*******************************************************************************/
+
+#include "../tests/usm/usm_api.h"
+#include "common/benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace usm_bandwidth_benchmark {
+using namespace sycl_cts;
+using usm_api::allocation;
+
+class dependency_kernel;
+
+/** Largest transfer size of the sweep */
+constexpr std::size_t max_sweep_size = std::size_t{4} << 30;
+
+/** Transfers of at least this size use fewer samples */
+constexpr std::size_t large_transfer_size = std::size_t{64} << 20;
+
+/**
+ * @brief Transfer sizes in bytes, from 4 B up to 4 GiB, limited by the maximum
+ *        allocation size and a quarter of the global memory of the device
+ */
+std::vector<std::size_t> get_sizes(const sycl::queue& queue) {
+  const auto device = queue.get_device();
+  const std::size_t limit = std::min<std::size_t>(
+      {max_sweep_size,
+       static_cast<std::size_t>(
+           device.get_info<sycl::info::device::max_mem_alloc_size>()),
+       static_cast<std::size_t>(
+           device.get_info<sycl::info::device::global_mem_size>() / 4)});
+  std::vector<std::size_t> sizes;
+  for (std::size_t size = 4; size <= limit; size *= 4) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+std::size_t get_samples(std::size_t size) {
+  const auto samples = benchmark::get_sample_count();
+  return size >= large_transfer_size ? std::min<std::size_t>(samples, 10)
+                                     : samples;
+}
+
+template <allocation alloc>
+bool is_supported(const sycl::queue& queue) {
+  constexpr auto kind = usm_api::map_usm_allocation<alloc>();
+  return queue.get_device().has(usm_helper::get_aspect<kind>());
+}
+
+template <allocation alloc>
+auto allocate(const sycl::queue& queue, std::size_t size) {
+  constexpr auto kind = usm_api::map_usm_allocation<alloc>();
+  auto memory = usm_helper::allocate_usm_memory<kind, unsigned char>(queue,
+                                                                     size);
+  REQUIRE(memory != nullptr);
+  return memory;
+}
+
+/**
+ * @brief Measures a USM command submitted through the given caller for every
+ *        transfer size
+ * @param command Callable submitting the command for a given size to the queue
+ *        or handler passed
+ */
+template <typename CallerT, typename CommandT>
+void sweep(sycl::queue& queue, const std::string& name,
+           const std::vector<std::size_t>& sizes, CommandT command) {
+  for (const auto size : sizes) {
+    const auto stats = benchmark::measure(
+        [&] {
+          CallerT::submit(queue, [&](auto& parent) { command(parent, size); });
+          queue.wait_and_throw();
+        },
+        get_samples(size));
+    benchmark::report_bandwidth(name, stats, size);
+  }
+}
+
+template <allocation src, allocation dst>
+void memcpy_sweep(sycl::queue& queue, const std::vector<std::size_t>& sizes) {
+  const auto description = "from " +
+                           usm_api::get_allocation_decription<src>() + " to " +
+                           usm_api::get_allocation_decription<dst>();
+  if (!is_supported<src>(queue) || !is_supported<dst>(queue)) {
+    WARN("Skipping memcpy " << description << ": not supported by device");
+    return;
+  }
+  const auto source = allocate<src>(queue, sizes.back());
+  const auto destination = allocate<dst>(queue, sizes.back());
+  queue.memset(source.get(), 1, sizes.back()).wait_and_throw();
+
+  auto command = [&](auto& parent, std::size_t size) {
+    parent.memcpy(destination.get(), source.get(), size);
+  };
+  sweep<usm_api::caller::queue>(queue, "queue::memcpy " + description, sizes,
+                                command);
+  sweep<usm_api::caller::handler>(queue, "handler::memcpy " + description,
+                                  sizes, command);
+}
+
+template <allocation alloc>
+void fill_sweep(sycl::queue& queue, const std::vector<std::size_t>& sizes) {
+  const auto description = usm_api::get_allocation_decription<alloc>();
+  if (!is_supported<alloc>(queue)) {
+    WARN("Skipping fill of " << description << ": not supported by device");
+    return;
+  }
+  const auto memory = allocate<alloc>(queue, sizes.back());
+  auto* ptr = reinterpret_cast<int*>(memory.get());
+
+  auto command = [&](auto& parent, std::size_t size) {
+    parent.fill(ptr, 1, size / sizeof(int));
+  };
+  sweep<usm_api::caller::queue>(queue, "queue::fill " + description, sizes,
+                                command);
+  sweep<usm_api::caller::handler>(queue, "handler::fill " + description,
+                                  sizes, command);
+}
+
+template <allocation alloc>
+void memset_sweep(sycl::queue& queue, const std::vector<std::size_t>& sizes) {
+  const auto description = usm_api::get_allocation_decription<alloc>();
+  if (!is_supported<alloc>(queue)) {
+    WARN("Skipping memset of " << description << ": not supported by device");
+    return;
+  }
+  const auto memory = allocate<alloc>(queue, sizes.back());
+
+  auto command = [&](auto& parent, std::size_t size) {
+    parent.memset(memory.get(), 1, size);
+  };
+  sweep<usm_api::caller::queue>(queue, "queue::memset " + description, sizes,
+                                command);
+  sweep<usm_api::caller::handler>(queue, "handler::memset " + description,
+                                  sizes, command);
+}
+
+template <allocation... allocs>
+struct allocation_list {};
+
+using all_allocations =
+    allocation_list<allocation::host, allocation::device, allocation::shared>;
+
+template <allocation src, allocation... dsts>
+void memcpy_sweep_to(sycl::queue& queue, const std::vector<std::size_t>& sizes,
+                     allocation_list<dsts...>) {
+  (memcpy_sweep<src, dsts>(queue, sizes), ...);
+}
+
+template <allocation... srcs>
+void memcpy_sweep_all(sycl::queue& queue, const std::vector<std::size_t>& sizes,
+                      allocation_list<srcs...>) {
+  (memcpy_sweep_to<srcs>(queue, sizes, all_allocations{}), ...);
+}
+
+TEST_CASE("USM memcpy bandwidth sweep", "[benchmark][usm_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  memcpy_sweep_all(queue, get_sizes(queue), all_allocations{});
+}
+
+TEST_CASE("USM fill bandwidth sweep", "[benchmark][usm_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto sizes = get_sizes(queue);
+  fill_sweep<allocation::host>(queue, sizes);
+  fill_sweep<allocation::device>(queue, sizes);
+  fill_sweep<allocation::shared>(queue, sizes);
+}
+
+TEST_CASE("USM memset bandwidth sweep", "[benchmark][usm_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  const auto sizes = get_sizes(queue);
+  memset_sweep<allocation::host>(queue, sizes);
+  memset_sweep<allocation::device>(queue, sizes);
+  memset_sweep<allocation::shared>(queue, sizes);
+}
+
+/**
+ * @brief Measures the latency of a minimal queue shortcut command without
+ *        dependencies, with a single and with multiple dependencies. The
+ *        dependencies are completed events of empty kernels, so only the
+ *        overhead of resolving them is measured.
+ */
+template <typename CommandT>
+void measure_event_variants(sycl::queue& queue, const std::string& name,
+                            CommandT command) {
+  std::vector<sycl::event> events;
+  for (std::size_t i = 0; i < usm_api::multiple_events; ++i) {
+    events.push_back(queue.submit([](sycl::handler& cgh) {
+      cgh.single_task<dependency_kernel>([] {});
+    }));
+  }
+  queue.wait_and_throw();
+
+  benchmark::report(name + " without events", benchmark::measure([&] {
+                      command().wait();
+                    }));
+  benchmark::report(name + " with a single event", benchmark::measure([&] {
+                      command(events.front()).wait();
+                    }));
+  benchmark::report(name + " with " +
+                        std::to_string(usm_api::multiple_events) + " events",
+                    benchmark::measure([&] { command(events).wait(); }));
+}
+
+TEST_CASE("USM command latency with event dependencies",
+          "[benchmark][usm_bandwidth]") {
+  SYCL_CTS_SKIP_IF_BENCHMARKS_DISABLED();
+  auto& queue = once_per_unit::get_queue();
+  if (!is_supported<allocation::device>(queue)) {
+    SKIP("Device does not support USM device allocations");
+  }
+  constexpr std::size_t size = sizeof(int);
+  const auto source = allocate<allocation::device>(queue, size);
+  const auto destination = allocate<allocation::device>(queue, size);
+  auto* ptr = reinterpret_cast<int*>(destination.get());
+
+  measure_event_variants(queue, "queue::memcpy of 4 B",
+                         [&](const auto&... events) {
+                           return queue.memcpy(destination.get(), source.get(),
+                                               size, events...);
+                         });
+  measure_event_variants(queue, "queue::fill of 4 B",
+                         [&](const auto&... events) {
+                           return queue.fill(ptr, 1, 1, events...);
+                         });
+  measure_event_variants(queue, "queue::memset of 4 B",
+                         [&](const auto&... events) {
+                           return queue.memset(destination.get(), 1, size,
+                                               events...);
+                         });
+}
+
+}  // namespace usm_bandwidth_benchmark
@@ -1,6 +1,19 @@
 set(CMAKE_CXX_STANDARD 17)
 add_library(SYCL::SYCL INTERFACE IMPORTED GLOBAL)
 target_link_libraries(SYCL::SYCL INTERFACE AdaptiveCpp::acpp-rt)
+# The generic single-pass compiler (SSCP) compiles each source file in a single
+# clang invocation, which can use a precompiled header. All other targets
+# compile host and device code in separate passes that would all pick up the
+# host PCH. Without explicit targets, acpp compiles for the generic target.
+set(acpp_targets "${ACPP_TARGETS}")
+if(NOT acpp_targets)
+    set(acpp_targets "$ENV{ACPP_TARGETS}")
+endif()
+if(NOT acpp_targets OR acpp_targets STREQUAL "generic")
+    set(SYCL_CTS_PCH_SUPPORTED ON)
+else()
+    set(SYCL_CTS_PCH_SUPPORTED OFF)
+endif()
 # add_sycl_executable_implementation function
 # Builds a SYCL program, compiling multiple SYCL test case source files into a
 # test executable, invoking a single-source/device compiler
@@ -1,6 +1,12 @@
 set(CMAKE_CXX_STANDARD 17)
 add_library(SYCL::SYCL INTERFACE IMPORTED GLOBAL)
 target_link_libraries(SYCL::SYCL INTERFACE DPCPP::Runtime)
+# Precompiled headers are not supported. DPC++ compiles each source in separate
+# host and device passes, and CMake passes the PCH using -Xclang options, which
+# the driver forwards to both of them. The device pass rejects a PCH built for
+# the host, and there is no driver option limiting -Xclang options to the host
+# pass.
+set(SYCL_CTS_PCH_SUPPORTED OFF)
 # add_sycl_executable_implementation function
 # Builds a SYCL program, compiling multiple SYCL test case source files into a
 # test executable, invoking a single-source/device compiler
@@ -1,6 +1,8 @@
 set(CMAKE_CXX_STANDARD 23)
 add_library(SYCL::SYCL INTERFACE IMPORTED GLOBAL)
 target_link_libraries(SYCL::SYCL INTERFACE ProtoSYCL)
+# ProtoSYCL is a host-only library, so precompiled headers can be used.
+set(SYCL_CTS_PCH_SUPPORTED ON)
 # add_sycl_executable_implementation function
 # Builds a SYCL program, compiling multiple SYCL test case source files into a
 # test executable, invoking a single-source/device compiler
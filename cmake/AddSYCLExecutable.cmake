@@ -22,6 +22,12 @@ find_file(SYCL_IMPLEMENTATION_ADAPTER
 )
 include("${SYCL_IMPLEMENTATION_ADAPTER}")
 
+# Adapters declare whether precompiled headers can be used with the
+# implementation by setting SYCL_CTS_PCH_SUPPORTED.
+if(NOT DEFINED SYCL_CTS_PCH_SUPPORTED)
+    set(SYCL_CTS_PCH_SUPPORTED OFF)
+endif()
+
 # Default to C++17 if the SYCL implementation does not specify a C++ standard version.
 if(NOT CMAKE_CXX_STANDARD)
     set(CMAKE_CXX_STANDARD 17)
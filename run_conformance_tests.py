@@ -5,6 +5,8 @@ import sys
 import xml.etree.ElementTree as ET
 import json
 import argparse
+import glob
+import re
 import shlex
 
 REPORT_HEADER = """<?xml version="1.0" encoding="UTF-8"?>
@@ -93,6 +95,22 @@ def handle_args(argv):
         help='Skip build step and perform only testing for already compiled tests.',
         required=False,
         action='store_true')
+    parser.add_argument(
+        '-j',
+        '--jobs',
+        help='Split each test executable into the given number of shards '
+        'and run them as parallel processes.',
+        type=int,
+        default=1,
+        required=False)
+    parser.add_argument(
+        '--ctest-parallel-level',
+        help='Number of tests CTest runs in parallel, 1 by default. All '
+        'tests use the device selected by --device. \'auto\' runs a few '
+        'tests on it concurrently, limited by the number of host cores.',
+        type=str,
+        default='1',
+        required=False)
     parser.add_argument('--commit-hash',
                         help='Original SYCL-CTS commit hash used for the run',
                         type=str,
@@ -104,6 +122,17 @@ def handle_args(argv):
     test_deprecated_features = 'OFF' if args.disable_deprecated_features else 'ON'
     full_feature_set = 'OFF' if args.reduced_feature_set else 'ON'
 
+    if args.jobs < 1:
+        print('Fatal error: --jobs must be greater than 0.')
+        exit(-1)
+
+    if (args.ctest_parallel_level != 'auto' and
+            (not args.ctest_parallel_level.isdigit() or
+             int(args.ctest_parallel_level) < 1)):
+        print('Fatal error: --ctest-parallel-level must be \'auto\' or an '
+              'integer greater than 0.')
+        exit(-1)
+
     if (args.build_only and args.run_only):
         print('Fatal error: --build-only and --run-only can not be enabled '
               'together in a single script run.')
@@ -113,7 +142,8 @@ def handle_args(argv):
             full_conformance, test_deprecated_features, args.exclude_categories,
             args.implementation_name, args.additional_cmake_args, args.device,
             args.additional_ctest_args, args.build_only, args.run_only,
-            commit_hash, full_feature_set, args.build_dir)
+            commit_hash, full_feature_set, args.build_dir, args.jobs,
+            args.ctest_parallel_level)
 
 
 def split_additional_args(additional_args):
@@ -139,7 +169,7 @@ def generate_cmake_call(cmake_exe, build_dir, build_system_name,
                         full_conformance,
                         test_deprecated_features, exclude_categories,
                         implementation_name, additional_cmake_args, device,
-                        full_feature_set):
+                        full_feature_set, jobs):
     """
     Generates a CMake call based on the input in a form accepted by
     subprocess.call().
@@ -154,6 +184,7 @@ def generate_cmake_call(cmake_exe, build_dir, build_system_name,
         '-DSYCL_IMPLEMENTATION=' + implementation_name,
         '-DSYCL_CTS_CTEST_DEVICE=' + device,
         '-DSYCL_CTS_ENABLE_FEATURE_SET_FULL=' + full_feature_set,
+        '-DSYCL_CTS_CTEST_SHARD_COUNT=' + str(jobs),
         ]
     if exclude_categories is not None:
         call += ['-DSYCL_CTS_EXCLUDE_TEST_CATEGORIES=' + exclude_categories]
@@ -161,15 +192,18 @@ def generate_cmake_call(cmake_exe, build_dir, build_system_name,
     return call
 
 
-def generate_ctest_call(build_dir, additional_ctest_args):
+def generate_ctest_call(build_dir, additional_ctest_args, parallel_level):
     """
     Generates a CTest call based on the input in a form accepted by
     subprocess.call().
     """
-    return [
+    call = [
         'ctest', '.', '--test-dir', build_dir, '-T', 'Test', '--no-compress-output',
         '--test-output-size-passed', '0', '--test-output-size-failed', '0'
-    ] + split_additional_args(additional_ctest_args)
+    ]
+    if parallel_level > 1:
+        call += ['--parallel', str(parallel_level)]
+    return call + split_additional_args(additional_ctest_args)
 
 
 def generate_build_call(cmake_exe, build_dir, build_system_args):
@@ -193,12 +227,10 @@ def subprocess_call(parameter_list):
     return subprocess.call(parameter_list)
 
 
-def configure_and_run_tests(cmake_call, build_call, build_only,
-                            run_only, ctest_call):
+def configure_and_build(cmake_call, build_call, run_only):
     """
     Configures the tests with cmake to produce a ninja.build file.
     Runs the generated ninja file.
-    Runs ctest, overwriting any cached results.
     """
 
     error_code = 0
@@ -208,12 +240,124 @@ def configure_and_run_tests(cmake_call, build_call, build_only,
 
         error_code = subprocess_call(build_call)
 
-    if (not build_only):
-        error_code = subprocess_call(ctest_call)
-
     return error_code
 
 
+DURATIONS_FILENAME = 'cts_test_durations.json'
+
+
+def read_test_durations(build_dir):
+    """
+    Reads the per-test durations in seconds recorded by the previous run.
+    """
+
+    try:
+        with open(os.path.join(build_dir, DURATIONS_FILENAME),
+                  'r') as durations_file:
+            return json.load(durations_file)
+    except (OSError, json.JSONDecodeError):
+        return {}
+
+
+def write_test_durations(build_dir, test_xml_root):
+    """
+    Records the duration of each test from the CTest results, merged with the
+    durations of tests that did not run this time.
+    """
+
+    durations = read_test_durations(build_dir)
+    for test in test_xml_root.iter('Test'):
+        name = test.findtext('Name')
+        execution_time = test.findtext(
+            "Results/NamedMeasurement[@name='Execution Time']/Value")
+        if name is not None and execution_time is not None:
+            durations[name] = float(execution_time)
+
+    with open(os.path.join(build_dir, DURATIONS_FILENAME),
+              'w') as durations_file:
+        json.dump(durations, durations_file, indent=1, sort_keys=True)
+
+
+def schedule_longest_first(build_dir):
+    """
+    Seeds the CTest cost data with the durations of the previous run, which
+    makes a parallel CTest run start the longest tests first.
+    Returns the number of tests with a known duration.
+    """
+
+    durations = read_test_durations(build_dir)
+    if not durations:
+        return 0
+
+    temporary_dir = os.path.join(build_dir, 'Testing', 'Temporary')
+    os.makedirs(temporary_dir, exist_ok=True)
+    with open(os.path.join(temporary_dir, 'CTestCostData.txt'),
+              'w') as cost_file:
+        for name, duration in sorted(durations.items()):
+            cost_file.write('%s 1 %f\n' % (name, duration))
+        cost_file.write('---\n')
+    return len(durations)
+
+
+def count_devices(build_dir, device):
+    """
+    Lists the available devices using one of the built test executables.
+    Returns the number of devices and whether the device selected for the
+    CTS run is a CPU device, or (None, False) if the devices can not be
+    listed.
+    """
+
+    executables = sorted(
+        glob.glob(os.path.join(build_dir, 'bin', 'test_*')))
+    if not executables:
+        return (None, False)
+
+    try:
+        output = subprocess.run(
+            [executables[0], '--device', device, '--list-devices'],
+            stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+            universal_newlines=True, timeout=120).stdout
+    except (OSError, subprocess.SubprocessError):
+        return (None, False)
+
+    match = re.search(r'^(\d+) devices available', output, re.MULTILINE)
+    selected_cpu = re.search(r'^>\s+cpu\s', output, re.MULTILINE) is not None
+    return (int(match.group(1)) if match else None, selected_cpu)
+
+
+# Number of tests run concurrently on the selected device in 'auto' mode
+TESTS_PER_DEVICE = 2
+
+
+def get_ctest_parallel_level(build_dir, device, ctest_parallel_level):
+    """
+    Determines the number of tests CTest runs in parallel. All tests run on
+    the single device selected by --device. In 'auto' mode, a CPU device
+    shares the host cores with the test processes, so only one test per four
+    cores is run. Other devices run TESTS_PER_DEVICE tests, limited by the
+    number of host cores. If the selected device can not be determined, the
+    tests are run one at a time.
+    """
+
+    if ctest_parallel_level != 'auto':
+        return int(ctest_parallel_level)
+
+    cores = os.cpu_count() or 1
+    device_count, selected_cpu = count_devices(build_dir, device)
+    if not device_count:
+        level = 1
+        device_type = 'unknown'
+    elif selected_cpu:
+        level = min(TESTS_PER_DEVICE, max(1, cores // 4))
+        device_type = 'CPU'
+    else:
+        level = min(cores, TESTS_PER_DEVICE)
+        device_type = 'non-CPU'
+    print('Running up to %d tests in parallel (%d host cores, %s device)' %
+          (level, cores, device_type))
+    return level
+
+
 def collect_info_filenames(build_dir):
     """
     Collects all the .info test result files in the Testing directory.
@@ -255,6 +399,138 @@ def get_valid_json_info(info_filenames):
     return json.loads(reference_info)
 
 
+SHARD_NAME_REGEX = re.compile(r'^(.*)_shard(\d+)$')
+
+
+def merge_shard_timing_reports(build_dir):
+    """
+    Combines the timing reports of all shards of a test executable into a
+    single report, which is used both for the conformance report and for
+    balancing the shards of the next run.
+    """
+
+    testing_dir = os.path.join(build_dir, 'Testing')
+    shard_reports = {}
+    for filename in sorted(glob.glob(os.path.join(testing_dir, '*.timing'))):
+        match = SHARD_NAME_REGEX.match(
+            os.path.splitext(os.path.basename(filename))[0])
+        if match:
+            shard_reports.setdefault(match.group(1), []).append(filename)
+
+    for name, filenames in shard_reports.items():
+        entries = []
+        for filename in filenames:
+            with open(filename, 'r') as timing_file:
+                try:
+                    entries += json.load(timing_file)
+                except json.JSONDecodeError:
+                    print('Warning: ignoring malformed timing report ' +
+                          filename)
+            os.remove(filename)
+        with open(os.path.join(testing_dir, name + '.timing'),
+                  'w') as timing_file:
+            json.dump(entries, timing_file, indent=1)
+
+
+def merge_sharded_tests(test_xml_root):
+    """
+    Combines the CTest results of all shards of a test executable into a
+    single test entry named after the executable. The merged test only passes
+    if all of its shards have passed.
+    """
+
+    for testing in test_xml_root.iter('Testing'):
+        merged = {}
+        for test in list(testing.findall('Test')):
+            match = SHARD_NAME_REGEX.match(test.findtext('Name', ''))
+            if not match:
+                continue
+            name = match.group(1)
+            if name not in merged:
+                merged[name] = test
+                test.find('Name').text = name
+                full_name = test.find('FullName')
+                if full_name is not None:
+                    full_name.text = SHARD_NAME_REGEX.sub(
+                        r'\1', full_name.text or '')
+                continue
+
+            target = merged[name]
+            testing.remove(test)
+            if test.attrib.get('Status') != 'passed':
+                target.attrib['Status'] = test.attrib.get('Status', 'failed')
+
+            target_results = target.find('Results')
+            results = test.find('Results')
+            if target_results is None or results is None:
+                continue
+            for measurement in results.findall('NamedMeasurement'):
+                target_measurement = target_results.find(
+                    "NamedMeasurement[@name='%s']" % measurement.get('name'))
+                if target_measurement is None:
+                    target_results.append(measurement)
+                elif measurement.get('type') == 'numeric/double':
+                    value = target_measurement.find('Value')
+                    value.text = str(
+                        float(value.text) +
+                        float(measurement.findtext('Value', '0')))
+            output = results.find('Measurement/Value')
+            target_output = target_results.find('Measurement/Value')
+            if output is not None and target_output is not None:
+                target_output.text = (target_output.text or '') + \
+                    (output.text or '')
+
+        # Keep a single entry per executable in the list of tests
+        test_list = testing.find('TestList')
+        if test_list is not None:
+            seen = set()
+            for test in list(test_list):
+                test.text = SHARD_NAME_REGEX.sub(r'\1', test.text or '')
+                if test.text in seen:
+                    test_list.remove(test)
+                seen.add(test.text)
+
+    return test_xml_root
+
+
+def merge_timing_reports(build_dir, test_xml_root):
+    """
+    Attaches the per test case and section timings written by each test
+    executable (see the --timing-report option) to the corresponding test
+    entry of the xml tree.
+    """
+
+    testing_dir = os.path.join(build_dir, 'Testing')
+    for test in test_xml_root.iter('Test'):
+        name = test.findtext('Name')
+        if name is None:
+            continue
+        timing_filename = os.path.join(testing_dir, name + '.timing')
+        if not os.path.isfile(timing_filename):
+            continue
+        with open(timing_filename, 'r') as timing_file:
+            try:
+                entries = json.load(timing_file)
+            except json.JSONDecodeError:
+                print('Warning: ignoring malformed timing report ' +
+                      timing_filename)
+                continue
+
+        timing_report = ET.SubElement(test, 'TimingReport')
+        for entry in entries:
+            attribs = {
+                'TestCase': entry['test-case'],
+                'Section': entry['section'],
+                'WallTime': str(entry['wall-time']),
+                'Submissions': str(entry['submissions'])
+            }
+            if 'device-time' in entry:
+                attribs['DeviceTime'] = str(entry['device-time'])
+            ET.SubElement(timing_report, 'Timing', attribs)
+
+    return test_xml_root
+
+
 def get_xml_test_results(build_dir):
     """
     Finds the xml file output by the test and returns the rool of the xml tree.
@@ -316,33 +592,48 @@ def main(argv=sys.argv[1:]):
     (cmake_exe, build_system_name, build_system_args, full_conformance,
      test_deprecated_features, exclude_categories, implementation_name,
      additional_cmake_args, device, additional_ctest_args, build_only, run_only,
-     commit_hash, full_feature_set, build_dir) = handle_args(argv)
+     commit_hash, full_feature_set, build_dir, jobs,
+     ctest_parallel_level) = handle_args(argv)
 
     # Generate a cmake call in a form accepted by subprocess.call()
     cmake_call = generate_cmake_call(cmake_exe, build_dir, build_system_name,
                                      full_conformance, test_deprecated_features,
                                      exclude_categories, implementation_name,
                                      additional_cmake_args, device,
-                                     full_feature_set)
-
-    # Generate a CTest call in a form accepted by subprocess.call()
-    ctest_call = generate_ctest_call(build_dir, additional_ctest_args)
+                                     full_feature_set, jobs)
 
     build_call = generate_build_call(cmake_exe, build_dir, build_system_args)
 
-    # Configure the build system with cmake, run the build, and run the tests.
-    error_code = configure_and_run_tests(cmake_call, build_call, build_only,
-                                         run_only, ctest_call)
+    # Configure the build system with cmake and run the build.
+    error_code = configure_and_build(cmake_call, build_call, run_only)
 
     if build_only:
         return error_code
 
+    # Run the longest tests of the previous run first, which matters if
+    # several tests are run in parallel.
+    schedule_longest_first(build_dir)
+    parallel_level = get_ctest_parallel_level(build_dir, device,
+                                              ctest_parallel_level)
+
+    # Generate a CTest call in a form accepted by subprocess.call() and run
+    # the tests, overwriting any cached results.
+    ctest_call = generate_ctest_call(build_dir, additional_ctest_args,
+                                     parallel_level)
+    error_code = subprocess_call(ctest_call)
+
+    # Combine the timing reports of sharded test executables.
+    merge_shard_timing_reports(build_dir)
+
     # Collect the test info files, validate them and get the contents as json.
     info_filenames = collect_info_filenames(build_dir)
     info_json = get_valid_json_info(info_filenames)
 
     # Get the xml results and update with the necessary information.
     result_xml_root = get_xml_test_results(build_dir)
+    write_test_durations(build_dir, result_xml_root)
+    result_xml_root = merge_sharded_tests(result_xml_root)
+    result_xml_root = merge_timing_reports(build_dir, result_xml_root)
     result_xml_root = update_xml_attribs(info_json, implementation_name,
                                          result_xml_root, full_conformance,
                                          cmake_call, build_system_name,
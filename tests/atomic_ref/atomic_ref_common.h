@@ -194,12 +194,23 @@ inline auto get_conformance_pointers_type_pack() {
 
 /**
  * @brief Factory function for getting type_pack with memory_order values
+ *
+ * With SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE only the default order of
+ * sycl::atomic_ref is instantiated. atomic_ref_test passes all others at
+ * runtime to the operations taking an explicit order, the tests of the
+ * operators are only run for the instantiated default order.
  */
 inline auto get_memory_orders() {
+#if SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
+  static const auto memory_orders =
+      value_pack<sycl::memory_order,
+                 sycl::memory_order::relaxed>::generate_named();
+#else
   static const auto memory_orders =
       value_pack<sycl::memory_order, sycl::memory_order::relaxed,
                  sycl::memory_order::acq_rel,
                  sycl::memory_order::seq_cst>::generate_named();
+#endif  // SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
   return memory_orders;
 }
 
@@ -210,10 +221,16 @@ inline auto get_memory_orders() {
 // working group clarified that using it with any sycl::atomic_ref operation
 // is undefined behaviour.
 inline auto get_memory_scopes() {
+#if SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
+  static const auto memory_scopes =
+      value_pack<sycl::memory_scope,
+                 sycl::memory_scope::device>::generate_named();
+#else
   static const auto memory_scopes =
       value_pack<sycl::memory_scope, sycl::memory_scope::sub_group,
                  sycl::memory_scope::work_group, sycl::memory_scope::device,
                  sycl::memory_scope::system>::generate_named();
+#endif  // SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
   return memory_scopes;
 }
 
@@ -141,7 +141,11 @@ class atomic_ref_test {
     if (memory_order_and_scope_are_supported(queue,
                                              memory_order_for_atomic_ref_obj,
                                              memory_scope_for_atomic_ref_obj)) {
-#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE || SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
+      // The orders and scopes passed to the atomic operations are runtime
+      // values, so all of them are covered by the same kernel instantiation.
+      // Tests of operations without order and scope parameters, e.g. the
+      // operators, only depend on the default order and scope of the type.
       if (require_combination_for_full_conformance()) {
         for (auto order : memory_orders) {
           for (auto scope : memory_scopes) {
@@ -161,7 +165,8 @@ class atomic_ref_test {
       run_on_device(type_name, memory_order, memory_scope, address_space,
                     memory_order_for_atomic_ref_obj,
                     memory_scope_for_atomic_ref_obj);
-#endif  // SYCL_CTS_ENABLE_FULL_CONFORMANCE
+#endif  // SYCL_CTS_ENABLE_FULL_CONFORMANCE ||
+        // SYCL_CTS_ATOMIC_REF_RUNTIME_ORDER_SCOPE
     }
   }
 };
@@ -175,4 +175,16 @@ DISABLED_FOR_TEST_CASE(AdaptiveCpp)
 #endif
 });
 
+DISABLED_FOR_TEST_CASE(AdaptiveCpp)
+("sycl::atomic_ref throughput under contention. long long type",
+ "[atomic_ref_stress]")({
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::atomic64))
+    SKIP(
+        "Device does not support atomic64 operations. "
+        "Skipping the test case.");
+
+  atomic_ref_stress_test::run_contention<long long>{}("long long");
+});
+
 }  // namespace atomic_ref_stress_test_atomic64
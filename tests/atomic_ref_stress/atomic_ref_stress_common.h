@@ -9,12 +9,18 @@
 #ifndef SYCL_CTS_ATOMIC_REF_STRESS_TEST_H
 #define SYCL_CTS_ATOMIC_REF_STRESS_TEST_H
 
+#include "../../util/random.h"
+#include "../../util/stress_config.h"
 #include "../atomic_ref/atomic_ref_common.h"
 #include "../common/once_per_unit.h"
 #include "../common/section_name_builder.h"
 #include "../common/type_coverage.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <vector>
 
 constexpr size_t max_size = 32768;
 
@@ -277,6 +283,156 @@ class atomicity_with_host_code {
   }
 };
 #endif
+/**
+ * @brief Load generated by the contention stress test, derived from
+ *        util::stress_config
+ *
+ * Every work-item performs `iterations` fetch_add operations. A fraction of
+ * `contention` of them targets one of `hot_spots` counters, all others target
+ * a counter only used by the work-item itself. Which operations target a hot
+ * spot is decided by `rng`, so the access pattern can be reproduced using the
+ * `--seed` CLI parameter. With memory_scope::work_group each work-group gets
+ * its own set of hot spots, as atomicity is not guaranteed across work-groups.
+ */
+struct contention_load {
+  size_t hot_spots;
+  size_t iterations;
+  // Operations with a random value below this threshold target a hot spot
+  uint64_t threshold;
+  util::counter_rng rng = util::counter_rng::from_config();
+  size_t global_range;
+  size_t local_range;
+  bool per_group_hot_spots;
+
+  size_t hot_spot_count() const {
+    return per_group_hot_spots ? hot_spots * (global_range / local_range)
+                               : hot_spots;
+  }
+
+  uint64_t operation_count() const {
+    return static_cast<uint64_t>(global_range) * iterations;
+  }
+
+  /**
+   * @brief Index of the counter targeted by an operation. Hot spots come
+   *        first, followed by one counter per work-item.
+   */
+  size_t get_target(size_t global_id, size_t local_id, size_t group_id,
+                    size_t iteration) const {
+    const uint64_t operation =
+        static_cast<uint64_t>(global_id) * iterations + iteration;
+    if (rng.uint32(operation) >= threshold) {
+      return hot_spot_count() + global_id;
+    }
+    const size_t hot_spot = (local_id + iteration) % hot_spots;
+    return per_group_hot_spots ? group_id * hot_spots + hot_spot : hot_spot;
+  }
+
+  /**
+   * @brief Replays all operations on the host to compute the expected value
+   *        of every counter after a single kernel launch
+   */
+  template <typename T>
+  std::vector<T> get_expected() const {
+    std::vector<T> expected(hot_spot_count() + global_range, T(0));
+    for (size_t global_id = 0; global_id < global_range; ++global_id) {
+      const size_t local_id = global_id % local_range;
+      const size_t group_id = global_id / local_range;
+      for (size_t i = 0; i < iterations; ++i) {
+        expected[get_target(global_id, local_id, group_id, i)] += T(1);
+      }
+    }
+    return expected;
+  }
+};
+
+template <typename T, typename MemoryOrderT, typename MemoryScopeT,
+          typename AddressSpaceT>
+class contention {
+  static constexpr sycl::memory_order MemoryOrder = MemoryOrderT::value;
+  static constexpr sycl::memory_scope MemoryScope = MemoryScopeT::value;
+  static constexpr sycl::access::address_space AddressSpace =
+      AddressSpaceT::value;
+
+ public:
+  void operator()(const std::string& type_name,
+                  const std::string& memory_order_name,
+                  const std::string& memory_scope_name,
+                  const std::string& address_space_name) {
+    const auto section_name = atomic_ref::tests::common::get_section_name(
+        type_name, memory_order_name, memory_scope_name, address_space_name,
+        "contention");
+    INFO(section_name);
+    auto queue = once_per_unit::get_queue();
+    if (!atomic_ref::tests::common::memory_order_and_scope_are_supported(
+            queue, MemoryOrder, MemoryScope))
+      return;
+
+    const auto& config = util::get<util::stress_config>();
+    const auto device = queue.get_device();
+    contention_load load;
+    load.hot_spots = config.get_hot_spots();
+    load.iterations = config.get_iterations();
+    load.threshold = static_cast<uint64_t>(config.get_contention() *
+                                           4294967296.0);
+    load.local_range = std::min<size_t>(
+        device.get_info<sycl::info::device::max_work_group_size>(), 256);
+    const size_t group_count = std::min<size_t>(
+        device.get_info<sycl::info::device::max_compute_units>() * 4,
+        max_size * 32 / load.local_range);
+    load.global_range = group_count * load.local_range;
+    load.per_group_hot_spots = MemoryScope == sycl::memory_scope::work_group;
+    const std::vector<T> expected = load.template get_expected<T>();
+
+    sycl::buffer<T> counters{sycl::range<1>{expected.size()}};
+    size_t launches = 0;
+    size_t failed_launches = 0;
+    std::chrono::duration<double> kernel_time{0};
+    do {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{counters, cgh, sycl::write_only, sycl::no_init};
+        cgh.fill(acc, T(0));
+      });
+      queue.wait_and_throw();
+
+      const auto start = std::chrono::steady_clock::now();
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{counters, cgh, sycl::read_write};
+        cgh.parallel_for(
+            sycl::nd_range<1>(load.global_range, load.local_range),
+            [=](sycl::nd_item<1> item) {
+              const size_t global_id = item.get_global_linear_id();
+              const size_t local_id = item.get_local_linear_id();
+              const size_t group_id = item.get_group_linear_id();
+              for (size_t i = 0; i < load.iterations; ++i) {
+                sycl::atomic_ref<T, MemoryOrder, MemoryScope, AddressSpace>
+                    a_r{acc[load.get_target(global_id, local_id, group_id,
+                                            i)]};
+                a_r.fetch_add(T(1));
+              }
+            });
+      });
+      queue.wait_and_throw();
+      kernel_time += std::chrono::steady_clock::now() - start;
+      ++launches;
+
+      sycl::host_accessor result{counters, sycl::read_only};
+      if (!std::equal(expected.begin(), expected.end(), result.begin()))
+        ++failed_launches;
+    } while (kernel_time < config.get_duration());
+
+    const double operations =
+        static_cast<double>(load.operation_count()) * launches;
+    WARN(section_name << ": " << std::scientific << std::setprecision(3)
+                      << operations / kernel_time.count() << " ops/s ("
+                      << load.global_range << " work-items, "
+                      << load.iterations << " iterations, " << load.hot_spots
+                      << " hot spots, contention " << config.get_contention()
+                      << ", " << launches << " launches)");
+    CHECK(failed_launches == 0);
+  }
+};
+
 template <typename T>
 struct run_atomicity_device_scope {
   void operator()(const std::string& type_name) {
@@ -353,6 +509,25 @@ struct run_ordering {
                                       address_spaces, type_name);
   }
 };
+template <typename T>
+struct run_contention {
+  void operator()(const std::string& type_name) {
+    const auto memory_orders =
+        value_pack<sycl::memory_order, sycl::memory_order::relaxed,
+                   sycl::memory_order::acq_rel,
+                   sycl::memory_order::seq_cst>::generate_named();
+    const auto memory_scopes =
+        value_pack<sycl::memory_scope, sycl::memory_scope::work_group,
+                   sycl::memory_scope::device,
+                   sycl::memory_scope::system>::generate_named();
+    const auto address_spaces =
+        value_pack<sycl::access::address_space,
+                   sycl::access::address_space::global_space>::generate_named();
+
+    for_all_combinations<contention, T>(memory_orders, memory_scopes,
+                                        address_spaces, type_name);
+  }
+};
 #ifdef __cpp_lib_atomic_ref
 template <typename T>
 struct run_atomicity_with_host_code {
@@ -64,4 +64,12 @@ DISABLED_FOR_TEST_CASE(AdaptiveCpp)
 #endif
 });
 
+DISABLED_FOR_TEST_CASE(AdaptiveCpp)
+("sycl::atomic_ref throughput under contention. core types",
+ "[atomic_ref_stress]")({
+  const auto type_pack = named_type_pack<int, unsigned int>::generate(
+      "int", "unsigned int");
+  for_all_types<atomic_ref_stress_test::run_contention>(type_pack);
+});
+
 }  // namespace atomic_ref_stress_test_core
@@ -309,7 +309,7 @@ void test_async_wg_copy(sycl::queue &queue, sycl_cts::util::logger &log,
         sycl::buffer<bool, 1>(result.data(),
                                   sycl::range<1>(result.size()));
 
-    queue.submit([&](sycl::handler &cgh) {
+    sycl_cts::util::submit_and_record(queue, [&](sycl::handler &cgh) {
     auto accResult =
         resultBuffer.template get_access<sycl::access_mode::write>(cgh);
     auto accGlobal =
@@ -416,7 +416,7 @@ void test_wait_for(sycl::queue &queue, sycl_cts::util::logger &log,
     auto resultBuffer =
         sycl::buffer<bool, 1>(&result, sycl::range<1>(1));
 
-    queue.submit([&](sycl::handler &cgh) {
+    sycl_cts::util::submit_and_record(queue, [&](sycl::handler &cgh) {
     auto accResult =
         resultBuffer.template get_access<sycl::access_mode::write>(cgh);
     auto accGlobal =
@@ -19,6 +19,7 @@
 #include "../../util/proxy.h"
 #include "../../util/sycl_enums.h"
 #include "../../util/test_base.h"
+#include "../../util/timing_report.h"
 
 #include "cts_async_handler.h"
 #include "cts_selector.h"
@@ -0,0 +1,183 @@
+# ************************************************************************
+#
+#   SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+#   SPDX-License-Identifier: Apache-2.0
+#
+#   SYCL Conformance Test Suite
+#
+# ************************************************************************
+
+# Generation of binary input corpora that are memory-mapped by the tests at run
+# time, see util/input_corpus.h for the file format. All values are handled as
+# bit patterns, so that NaN payloads, signaling NaNs and signed zeros are
+# written exactly.
+
+import itertools
+import math
+import random
+import struct
+import zlib
+
+MAGIC = b'SYCLCORP'
+VERSION = 1
+HEADER_FORMAT = '<8sIIIIQ'
+
+
+class FpFormat:
+    """IEEE 754 binary format of a floating-point element type"""
+
+    def __init__(self, name, struct_code, bits_code, mantissa_bits,
+                 exponent_bits):
+        self.name = name
+        self.struct_code = struct_code
+        self.bits_code = bits_code
+        self.mantissa_bits = mantissa_bits
+        self.exponent_bits = exponent_bits
+        self.size = struct.calcsize(bits_code)
+        self.sign = 1 << (self.size * 8 - 1)
+        self.exponent_bias = (1 << (exponent_bits - 1)) - 1
+        self.infinity = ((1 << exponent_bits) - 1) << mantissa_bits
+        self.quiet_bit = 1 << (mantissa_bits - 1)
+
+    def to_bits(self, value):
+        """Bits of the value rounded to nearest, infinity on overflow"""
+        try:
+            packed = struct.pack('<' + self.struct_code, float(value))
+        except OverflowError:
+            return self.infinity | (self.sign if value < 0 else 0)
+        return struct.unpack('<' + self.bits_code, packed)[0]
+
+    def from_bits(self, bits):
+        packed = struct.pack('<' + self.bits_code, bits)
+        return struct.unpack('<' + self.struct_code, packed)[0]
+
+    def power_of_two(self, exponent, negative=False):
+        """Bits of +-2^exponent, including subnormal powers of two"""
+        sign = self.sign if negative else 0
+        biased = exponent + self.exponent_bias
+        if biased >= 1:
+            return sign | (biased << self.mantissa_bits)
+        return sign | (1 << (self.mantissa_bits - 1 + biased))
+
+    def min_exponent(self):
+        """Exponent of the smallest subnormal value"""
+        return 1 - self.exponent_bias - self.mantissa_bits
+
+    def max_exponent(self):
+        return self.exponent_bias
+
+    def to_ordinal(self, bits):
+        """Maps bits of non-NaN values to integers in the order of the values,
+        with adjacent values mapped to adjacent integers"""
+        magnitude = bits & ~self.sign
+        return -magnitude if bits & self.sign else magnitude
+
+    def from_ordinal(self, ordinal):
+        ordinal = max(-self.infinity, min(self.infinity, ordinal))
+        return (self.sign | -ordinal) if ordinal < 0 else ordinal
+
+
+FORMATS = {
+    'half': FpFormat('half', 'e', 'H', 10, 5),
+    'float': FpFormat('float', 'f', 'I', 23, 8),
+    'double': FpFormat('double', 'd', 'Q', 52, 11),
+}
+
+
+def special_values(fmt):
+    """Zeros, infinities, NaNs and the limits of the subnormal and normal
+    ranges, together with values close to one"""
+    one = fmt.to_bits(1.0)
+    positive = [
+        0,
+        1,  # smallest subnormal
+        fmt.power_of_two(1 - fmt.exponent_bias) - 1,  # largest subnormal
+        fmt.power_of_two(1 - fmt.exponent_bias),  # smallest normal
+        fmt.to_bits(0.5),
+        one - 1,
+        one,
+        one + 1,
+        fmt.to_bits(2.0),
+        fmt.infinity - 1,  # largest finite value
+        fmt.infinity,
+    ]
+    nans = [
+        fmt.infinity | fmt.quiet_bit,
+        fmt.sign | fmt.infinity | fmt.quiet_bit,
+        fmt.infinity | 1,  # signaling
+        fmt.infinity | fmt.quiet_bit | 0x5a,  # payload
+    ]
+    return positive + [fmt.sign | bits for bits in positive] + nans
+
+
+def binade_values(fmt):
+    """Every power of two and the value before it, with both signs"""
+    values = []
+    for exponent in range(fmt.min_exponent(), fmt.max_exponent() + 1):
+        for negative in (False, True):
+            power = fmt.power_of_two(exponent, negative)
+            values.extend([power, power - 1])
+    return values
+
+
+def neighbors(fmt, bits, radius):
+    """All values within `radius` ulps of the given value, crossing zero and
+    stopping at infinity"""
+    ordinal = fmt.to_ordinal(bits)
+    return sorted({fmt.from_ordinal(o)
+                   for o in range(ordinal - radius, ordinal + radius + 1)})
+
+
+def near(fmt, values, radius):
+    """Values within `radius` ulps of the given real numbers rounded to the
+    format, e.g. of multiples of pi for trigonometric functions"""
+    result = []
+    for value in values:
+        result.extend(neighbors(fmt, fmt.to_bits(value), radius))
+    return result
+
+
+def random_bits(rng, fmt, count):
+    """Uniformly distributed bit patterns, covering all binades and NaNs"""
+    return [rng.getrandbits(fmt.size * 8) for _ in range(count)]
+
+
+def random_log_uniform(rng, fmt, count, min_exponent, max_exponent):
+    """Finite values with uniformly distributed exponents in the given range
+    and random signs"""
+    values = []
+    for _ in range(count):
+        magnitude = math.ldexp(1.0 + rng.random(),
+                               rng.randint(min_exponent, max_exponent))
+        values.append(fmt.to_bits(rng.choice((1.0, -1.0)) * magnitude))
+    return values
+
+
+def random_uniform(rng, fmt, count, low, high):
+    """Values uniformly distributed in [low, high]"""
+    return [fmt.to_bits(rng.uniform(low, high)) for _ in range(count)]
+
+
+def make_rng(name):
+    """Random number generator seeded by the given name, so that every corpus
+    is reproducible independent of which other corpora are generated"""
+    return random.Random(zlib.crc32(name.encode()))
+
+
+def cross(*argument_lists):
+    """All combinations of the given argument values, as one list per
+    argument"""
+    combinations = list(itertools.product(*argument_lists))
+    return [[c[i] for c in combinations] for i in range(len(argument_lists))]
+
+
+def write_corpus(path, fmt, arguments):
+    """Writes a corpus file containing one array of values per argument"""
+    count = len(arguments[0])
+    assert all(len(values) == count for values in arguments)
+    with open(path, 'wb') as output:
+        output.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, fmt.size,
+                                 len(arguments), 0, count))
+        for values in arguments:
+            output.write(struct.pack('<%d%s' % (count, fmt.bits_code),
+                                     *values))
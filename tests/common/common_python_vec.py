@@ -159,7 +159,7 @@ class ReverseData:
 kernel_template = Template("""  bool resArray[1] = {true};
   {
     sycl::buffer<bool, 1> boolBuffer(resArray, sycl::range<1>(1));
-    testQueue.submit([&](sycl::handler &cgh) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler &cgh) {
       auto resAcc = boolBuffer.get_access<sycl::access_mode::write>(cgh);
 
       cgh.single_task<class ${kernelName}>([=]() {
@@ -182,7 +182,7 @@ swizzle_kernel_template = Template("""
     bool resArray[1] = {true};
     {
       sycl::buffer<bool, 1> boolBuffer(resArray, sycl::range<1>(1));
-      testQueue.submit([&](sycl::handler &cgh) {
+      sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler &cgh) {
         sycl::accessor resAcc(boolBuffer, cgh, sycl::write_only);
         sycl::accessor vecAcc(vecBuffer, cgh, sycl::write_only);
 
@@ -125,7 +125,7 @@ std::array<typename kernelInvokeT::parameterT, numItems> store_instances() {
     sycl::buffer<item_t> itemBuf(items.data(), sycl::range<1>(items.size()));
 
     auto queue = sycl_cts::util::get_cts_object::queue();
-    queue.submit([&](sycl::handler& cgh) {
+    sycl_cts::util::submit_and_record(queue, [&](sycl::handler& cgh) {
       auto itemAcc = itemBuf.template get_access<sycl::access_mode::write>(cgh);
 
       kernelInvokeT{}(
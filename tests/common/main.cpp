@@ -7,17 +7,220 @@
 //
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
 #include <regex>
 #include <string>
+#include <vector>
 
 #define CATCH_CONFIG_RUNNER
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/internal/catch_clara.hpp>
+#include <catch2/internal/catch_test_case_registry_impl.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
 
 #include "./../../util/device_manager.h"
+#include "./../../util/host_thread_pool.h"
+#include "./../../util/input_corpus.h"
+#include "./../../util/random.h"
+#include "./../../util/stress_config.h"
+#include "./../../util/timing_report.h"
 #include "cts_selector.h"
 
+#ifdef __linux__
+#include <dlfcn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Forwards test case and section boundaries to the timing report, if enabled.
+ * Catch2 reports each test case as an outermost section of the same name.
+ */
+class timing_report_listener : public Catch::EventListenerBase {
+ public:
+  using Catch::EventListenerBase::EventListenerBase;
+
+  void sectionStarting(const Catch::SectionInfo& sectionInfo) override {
+    auto& report = sycl_cts::util::get<sycl_cts::util::timing_report>();
+    if (report.is_enabled()) {
+      report.begin_section(sectionInfo.name);
+    }
+  }
+
+  void sectionEnded(const Catch::SectionStats&) override {
+    auto& report = sycl_cts::util::get<sycl_cts::util::timing_report>();
+    if (report.is_enabled()) {
+      report.end_section();
+    }
+  }
+};
+
+CATCH_REGISTER_LISTENER(timing_report_listener)
+
+/**
+ * Escapes characters with a special meaning in Catch2 test specs.
+ */
+static std::string escape_test_spec(const std::string& name) {
+  std::string result;
+  for (const char c : name) {
+    if (c == '\\' || c == ',' || c == '[' || c == ']' || c == '*' ||
+        c == '"' || c == '~') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+/**
+ * Replaces Catch2's sharding by one that is balanced using the test case
+ * durations recorded in a previous timing report. Test cases are assigned
+ * longest first to the currently least loaded shard; test cases without a
+ * recorded duration are weighted with the mean of all known durations. The
+ * assignment only depends on the timing report and the test case order, so
+ * that all shards agree on it.
+ *
+ * @return false if no test case has been assigned to the selected shard
+ */
+static bool select_balanced_shard(Catch::Session& session,
+                                  const std::string& shardTimingsFile) {
+  const auto& config = session.config();
+  const auto tests = Catch::filterTests(Catch::getAllTestCasesSorted(config),
+                                        config.testSpec(), config);
+  const auto times =
+      sycl_cts::util::timing_report::read_test_case_times(shardTimingsFile);
+
+  double knownTime = 0;
+  std::size_t knownCount = 0;
+  std::vector<double> weights;
+  weights.reserve(tests.size());
+  for (const auto& test : tests) {
+    const auto it = times.find(test.getTestCaseInfo().name);
+    weights.push_back(it != times.end() ? it->second : -1.0);
+    if (it != times.end()) {
+      knownTime += it->second;
+      ++knownCount;
+    }
+  }
+  const double defaultWeight = knownCount > 0 ? knownTime / knownCount : 1.0;
+  for (auto& weight : weights) {
+    if (weight < 0) weight = defaultWeight;
+  }
+
+  std::vector<std::size_t> order(tests.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](std::size_t a, std::size_t b) {
+                     return weights[a] > weights[b];
+                   });
+
+  const auto shardCount = session.configData().shardCount;
+  const auto shardIndex = session.configData().shardIndex;
+  std::vector<double> loads(shardCount, 0.0);
+  std::vector<bool> selected(tests.size(), false);
+  for (const auto i : order) {
+    const auto shard = static_cast<unsigned int>(
+        std::min_element(loads.begin(), loads.end()) - loads.begin());
+    loads[shard] += weights[i];
+    selected[i] = shard == shardIndex;
+  }
+
+  std::string spec;
+  for (std::size_t i = 0; i < tests.size(); ++i) {
+    if (!selected[i]) continue;
+    if (!spec.empty()) spec += ',';
+    spec += escape_test_spec(tests[i].getTestCaseInfo().name);
+  }
+  if (spec.empty()) return false;
+
+  // The selected test cases already match the user provided test specs.
+  // Catch2 runs test cases matching any of the specs, so they are replaced
+  // rather than extended, which would run every match of the user specs again.
+  auto configData = session.configData();
+  configData.shardCount = 1;
+  configData.shardIndex = 0;
+  configData.testsOrTags = {spec};
+  session.useConfigData(configData);
+  return true;
+}
+
+/**
+ * Loads a test module built with SYCL_CTS_INDEPENDENT_TEST_MODULES, which
+ * registers its test cases when loaded. Each module is run in a process of its
+ * own, so the kernels of the application are exactly the kernels of the module.
+ */
+static bool load_test_module(const std::string& path) {
+#ifdef __linux__
+  if (dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL) != nullptr) {
+    return true;
+  }
+  printf("Failed to load test module: %s\n", dlerror());
+#else
+  printf("Test modules are only supported on Linux.\n");
+#endif
+  return false;
+}
+
+/**
+ * Runs each test module in a child process forked from the launcher once it
+ * has started up and discovered the devices, so that the modules only pay for
+ * loading their own kernels. The modules run one after the other and write
+ * their timing reports to separate files, which are merged afterwards.
+ *
+ * @param run Runs the test cases of the loaded module and returns the exit
+ *        code of the child process
+ */
+template <typename RunT>
+static int run_test_modules(const std::vector<std::string>& modules,
+                            const std::string& timingReportFile, RunT run) {
+#ifdef __linux__
+  // Discover the devices before forking, the children inherit the result
+  static_cast<void>(sycl::device(cts_selector));
+
+  auto& timing_report = sycl_cts::util::get<sycl_cts::util::timing_report>();
+  std::vector<std::string> moduleReports;
+  std::size_t failedModules = 0;
+  for (std::size_t i = 0; i < modules.size(); ++i) {
+    const std::string moduleReport =
+        timingReportFile.empty() ? ""
+                                 : timingReportFile + "." + std::to_string(i);
+    // Buffered output would be written by both processes otherwise
+    fflush(stdout);
+    const pid_t pid = fork();
+    if (pid < 0) {
+      perror("Failed to fork the test launcher");
+      return EXIT_FAILURE;
+    }
+    if (pid == 0) {
+      timing_report.set_output_file(moduleReport);
+      std::exit(load_test_module(modules[i]) ? run() : EXIT_FAILURE);
+    }
+
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      printf("Test module %s failed.\n", modules[i].c_str());
+      ++failedModules;
+    }
+    if (!moduleReport.empty()) moduleReports.push_back(moduleReport);
+  }
+
+  if (!timingReportFile.empty()) {
+    sycl_cts::util::timing_report::merge(moduleReports, timingReportFile);
+  }
+  printf("%zu of %zu test modules failed.\n", failedModules, modules.size());
+  return failedModules == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+#else
+  printf("Test modules are only supported on Linux.\n");
+  return EXIT_FAILURE;
+#endif
+}
+
 int main(int argc, char** argv) {
   using namespace sycl_cts;
 
@@ -26,6 +229,18 @@ int main(int argc, char** argv) {
 
   std::string devicePattern;
   std::string infoDumpFile;
+  std::string timingReportFile;
+  bool timingDeviceTime = false;
+  std::string shardTimingsFile;
+  std::vector<std::string> testModules;
+  std::string inputCorpusDir;
+  unsigned hostThreads = 0;
+  auto& stress = util::get<util::stress_config>();
+  std::size_t stressHotSpots = stress.get_hot_spots();
+  double stressContention = stress.get_contention();
+  std::size_t stressIterations = stress.get_iterations();
+  unsigned stressDuration = 0;
+  std::uint64_t seed = util::get<util::random_config>().get_seed();
   bool listDevices = false;
 
   using namespace Catch::Clara;
@@ -38,6 +253,39 @@ int main(int argc, char** argv) {
              Opt(listDevices)["--list-devices"]("List all available devices") |
              Opt(infoDumpFile, "file")["--info-dump"](
                  "Dump platform and device info to file") |
+             Opt(timingReportFile, "file")["--timing-report"](
+                 "Write per test case and section timings to file as JSON") |
+             Opt(timingDeviceTime)["--timing-device-time"](
+                 "Enable profiling on the queues of the tests to add the "
+                 "device time of recorded commands to --timing-report") |
+             Opt(shardTimingsFile, "file")["--shard-timings"](
+                 "Balance --shard-count shards using the test case timings "
+                 "from a previous --timing-report") |
+             Opt(testModules, "file")["--test-module"](
+                 "Load and run the test cases of a module built with "
+                 "SYCL_CTS_INDEPENDENT_TEST_MODULES. If given more than "
+                 "once, each module runs in a process forked after device "
+                 "discovery") |
+             Opt(hostThreads, "count")["--host-threads"](
+                 "Number of threads used for host-side verification, "
+                 "defaults to the number of host cores") |
+             Opt(stressHotSpots, "count")["--stress-hot-spots"](
+                 "Number of memory locations contended by stress tests") |
+             Opt(stressContention, "ratio")["--stress-contention"](
+                 "Fraction of stress test operations in [0, 1] that target "
+                 "a hot spot") |
+             Opt(stressIterations, "count")["--stress-iterations"](
+                 "Number of operations per work-item and stress test kernel "
+                 "launch") |
+             Opt(stressDuration, "milliseconds")["--stress-duration"](
+                 "Minimum time stress test kernels are launched repeatedly "
+                 "for") |
+             Opt(inputCorpusDir, "directory")["--input-corpus-dir"](
+                 "Directory containing the input corpora generated by the "
+                 "build, defaults to the build directory") |
+             Opt(seed, "seed")["--seed"](
+                 "Seed of the random inputs used by tests, the same seed "
+                 "always generates the same inputs") |
              session.cli();
 
   session.cli(cli);
@@ -47,6 +295,22 @@ int main(int argc, char** argv) {
     return returnCode;
   }
 
+  if (stressHotSpots == 0 || stressIterations == 0 ||
+      !(stressContention >= 0 && stressContention <= 1)) {
+    printf(
+        "--stress-hot-spots and --stress-iterations must be greater than 0, "
+        "--stress-contention must be within [0, 1].\n");
+    return EXIT_FAILURE;
+  }
+  stress.set_hot_spots(stressHotSpots);
+  stress.set_contention(stressContention);
+  stress.set_iterations(stressIterations);
+  stress.set_duration(std::chrono::milliseconds{stressDuration});
+  util::get<util::random_config>().set_seed(seed);
+  if (!inputCorpusDir.empty()) {
+    util::get<util::input_corpus_config>().set_directory(inputCorpusDir);
+  }
+
   auto& device_mngr = util::get<util::device_manager>();
   if (!devicePattern.empty()) {
     device_mngr.set_device_regex(std::regex(devicePattern));
@@ -61,5 +325,34 @@ int main(int argc, char** argv) {
     device_mngr.dump_info(infoDumpFile);
   }
 
-  return session.run();
+  util::get<util::host_thread_pool>().set_thread_count(hostThreads);
+
+  auto& timing_report = util::get<util::timing_report>();
+  timing_report.set_output_file(timingReportFile);
+  timing_report.set_device_time(timingDeviceTime);
+
+  auto run = [&] {
+    if (!shardTimingsFile.empty() && session.configData().shardCount > 1) {
+      if (!select_balanced_shard(session, shardTimingsFile)) {
+        printf("No test cases assigned to shard %u.\n",
+               session.configData().shardIndex);
+        return EXIT_SUCCESS;
+      }
+    }
+
+    const int result = session.run();
+
+    if (timing_report.is_enabled()) {
+      timing_report.write();
+    }
+    return result;
+  };
+
+  if (testModules.size() > 1) {
+    return run_test_modules(testModules, timingReportFile, run);
+  }
+  if (testModules.size() == 1 && !load_test_module(testModules.front())) {
+    return EXIT_FAILURE;
+  }
+  return run();
 }
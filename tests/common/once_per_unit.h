@@ -13,6 +13,7 @@
 #define __SYCLCTS_TESTS_COMMON_ONCE_PER_UNIT_H
 
 #include "../../util/logger.h"
+#include "../../util/timing_report.h"
 #include "../common/get_cts_object.h"
 
 namespace detail {
@@ -34,10 +35,22 @@ namespace {
  */
 namespace once_per_unit {
 /**
- * @brief Factory method; provides unique queue instance per compilation unit
+ * @brief Factory method; provides unique queue instance per compilation unit.
+ *        Profiling is only enabled with `--timing-device-time`, so that the
+ *        queue has the default configuration in conformance runs.
  */
 inline sycl::queue &get_queue() {
-  static auto q = sycl_cts::util::get_cts_object::queue();
+  static auto q = [] {
+    auto queue = sycl_cts::util::get_cts_object::queue();
+    const auto &report = sycl_cts::util::get<sycl_cts::util::timing_report>();
+    if (!report.is_device_time_enabled() ||
+        !queue.get_device().has(sycl::aspect::queue_profiling)) {
+      return queue;
+    }
+    return sycl::queue(queue.get_context(), queue.get_device(),
+                       cts_async_handler{},
+                       {sycl::property::queue::enable_profiling{}});
+  }();
   return q;
 }
 
@@ -66,7 +66,7 @@ void check_members_test(const std::string& type_name) {
   SECTION(section_name) {
     {
       sycl::buffer<bool, 1> res_buf(result, sycl::range(check_count));
-      queue.submit([&](sycl::handler& cgh) {
+      sycl_cts::util::submit_and_record(queue, [&](sycl::handler& cgh) {
         sycl::accessor res_acc(res_buf, cgh);
         cgh.single_task<kernel_range_id<T, Dim>>(
             [=] { check_members<T, Dim>(res_acc); });
@@ -460,7 +460,7 @@ void check_kernel(InitFunc init_func, const std::string& type_name,
   {
     sycl::buffer<int> buffer(results.data(), sycl::range<1>{result_size});
 
-    queue.submit([&](sycl::handler& cgh) {
+    sycl_cts::util::submit_and_record(queue, [&](sycl::handler& cgh) {
       auto accessor = buffer.template get_access<sycl::access_mode::write>(cgh);
       T t = init_func(cgh);
       // use non-simple parallel_for to be able to use local_accessor
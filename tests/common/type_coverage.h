@@ -262,6 +262,19 @@ using is_not_a_type_pack =
 
 }  // namespace sfinae
 
+/**
+ * @brief Overload to handle cases where no runtime arguments provided with
+ * unnamed type packs
+ *
+ * Declared ahead of the type pack overloads, as these call it once the last
+ * unnamed type pack has been unfolded and there is no argument left that would
+ * enable argument-dependent lookup.
+ */
+template <template <typename...> class Action, typename... ArgsT>
+inline void for_all_combinations() {
+  Action<ArgsT...>{}();
+}
+
 /**
  * @brief Generic function to run specific action for every combination of each
  * of the types given by appropriate type pack instances. Virtually any
@@ -384,15 +397,6 @@ inline void for_all_combinations(const unnamed_type_pack<HeadTypes...> &head,
   assert((typeNameIndex == sizeof...(HeadTypes)) && "Pack expansion failed");
 }
 
-/**
- * @brief Overload to handle cases where no runtime arguments provided with
- * unnamed type packs
- */
-template <template <typename...> class Action, typename... ArgsT>
-inline void for_all_combinations() {
-  Action<ArgsT...>{}();
-}
-
 /**
  * @brief Run action for each of types given by type_pack instance
  * @tparam action Functor template for action to run
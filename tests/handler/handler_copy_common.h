@@ -15,6 +15,7 @@
 #include <regex>
 #include <sstream>
 
+#include "../../util/device_compare.h"
 #include "../../util/sycl_exceptions.h"
 #include "../common/common.h"
 
@@ -208,6 +209,28 @@ struct scalar_init_op {
   dataT operator()(sycl::id<dims>) const { return value; }
 };
 
+/**
+ * Checks that the elements within a window have been filled with a value and
+ * all other elements still hold the canary value.
+ */
+template <typename dataT, int dims>
+struct fill_predicate {
+  sycl::id<dims> windowOffset;
+  sycl::range<dims> windowRange;
+  dataT expected;
+  dataT canary;
+
+  bool operator()(sycl::id<dims> idx, const dataT& received) const {
+    bool withinWindow = true;
+    for (int d = 0; d < dims; ++d) {
+      withinWindow = withinWindow && idx[d] >= windowOffset[d] &&
+                     idx[d] < windowOffset[d] + windowRange[d];
+    }
+    return type_helper<dataT>::equal(received,
+                                     withinWindow ? expected : canary);
+  }
+};
+
 template <typename dataT, int dims>
 struct encode_index_init_op {
   dataT operator()(sycl::id<dims> id) const {
@@ -474,22 +497,19 @@ class copy_test_context {
   void verify_fill(test_fn fn, dataT expected, const log_helper& lh) {
     run_test_function(fn, lh);
 
-    // TODO: Consider verifying directly on device.
-    auto acc = dstBuf->template get_access<sycl::access_mode::read>();
-    for (size_t i = 0; i < numElems; ++i) {
-      const auto idx = reconstruct_index(dstBufRange, i);
-      const auto received = acc[idx];
-      if (is_within_window(dstCopyOffset, dstCopyRange, idx)) {
-        if (!th::equal(received, expected)) {
-          log_error(lh, id_helper<3>::cast(idx), received, expected);
-          return;
-        }
-      } else {
-        if (!th::equal(received, deviceCanary)) {
-          log_canary_violation(lh, id_helper<3>::cast(idx), received);
-          return;
-        }
-      }
+    const auto result = util::compare_on_device(
+        queue, *dstBuf,
+        fill_predicate<dataT, dim_dst>{dstCopyOffset, dstCopyRange, expected,
+                                       deviceCanary},
+        1);
+    if (result.passed()) return;
+
+    const auto idx = reconstruct_index(dstBufRange, result.first_mismatches[0]);
+    const auto received = result.first_mismatch_values[0];
+    if (is_within_window(dstCopyOffset, dstCopyRange, idx)) {
+      log_error(lh, id_helper<3>::cast(idx), received, expected);
+    } else {
+      log_canary_violation(lh, id_helper<3>::cast(idx), received);
     }
   }
 
@@ -0,0 +1,127 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides tests for the on-device verification used by the handler copy
+//  tests
+//
+*******************************************************************************/
+
+#include "../../util/device_compare.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace handler_copy_verification {
+using namespace sycl_cts;
+
+/** Value of the elements injected as mismatches */
+constexpr int mismatch_value = -1;
+
+/** Buffer ranges with a different extent in each dimension */
+template <int Dims>
+sycl::range<Dims> get_range();
+template <>
+sycl::range<1> get_range<1>() {
+  return {140};
+}
+template <>
+sycl::range<2> get_range<2>() {
+  return {10, 14};
+}
+template <>
+sycl::range<3> get_range<3>() {
+  return {4, 5, 7};
+}
+
+/** Expects every element to hold its row-major linear index */
+template <int Dims>
+struct linear_index_predicate {
+  sycl::range<Dims> range;
+
+  bool operator()(sycl::id<Dims> id, const int& value) const {
+    std::size_t linear = 0;
+    for (int d = 0; d < Dims; ++d) linear = linear * range[d] + id[d];
+    return value == static_cast<int>(linear);
+  }
+};
+
+/**
+ * @brief Compares a buffer holding its linear indices, except for the
+ *        mismatches injected at the given linear indices
+ */
+template <int Dims>
+util::device_compare_result<int> compare_with_mismatches(
+    const std::vector<std::size_t>& mismatches, std::size_t max_reported) {
+  const auto range = get_range<Dims>();
+  std::vector<int> data(range.size());
+  for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<int>(i);
+  for (const auto i : mismatches) data[i] = mismatch_value;
+
+  sycl::buffer<int, Dims> buffer{data.data(), range};
+  return util::compare_on_device(once_per_unit::get_queue(), buffer,
+                                 linear_index_predicate<Dims>{range},
+                                 max_reported);
+}
+
+/**
+ * @brief Checks that the reported mismatches are the lowest injected ones, in
+ *        ascending order and with their values
+ */
+void check_reported(const util::device_compare_result<int>& result,
+                    std::vector<std::size_t> mismatches,
+                    std::size_t max_reported) {
+  std::sort(mismatches.begin(), mismatches.end());
+  mismatches.resize(std::min(mismatches.size(), max_reported));
+  CHECK(result.first_mismatches == mismatches);
+  CHECK(result.first_mismatch_values ==
+        std::vector<int>(mismatches.size(), mismatch_value));
+}
+
+TEMPLATE_TEST_CASE_SIG("compare_on_device reports injected mismatches",
+                       "[handler][dim]", ((int Dims), Dims), 1, 2, 3) {
+  constexpr std::size_t max_reported = 4;
+
+  SECTION("No mismatches") {
+    const auto result = compare_with_mismatches<Dims>({}, max_reported);
+    CHECK(result.passed());
+    CHECK(result.mismatch_count == 0);
+    CHECK(result.first_mismatches.empty());
+    CHECK(result.first_mismatch_values.empty());
+  }
+
+  SECTION("All mismatches recorded on the device") {
+    const std::vector<std::size_t> mismatches{97, 3, 139, 42};
+    const auto result = compare_with_mismatches<Dims>(mismatches, max_reported);
+    CHECK_FALSE(result.passed());
+    CHECK(result.mismatch_count == mismatches.size());
+    check_reported(result, mismatches, max_reported);
+  }
+
+  SECTION("More mismatches than reported, found by reading back") {
+    std::vector<std::size_t> mismatches;
+    for (std::size_t i = 138; i >= 18; i -= 8) mismatches.push_back(i);
+    mismatches.push_back(1);
+    const auto result = compare_with_mismatches<Dims>(mismatches, max_reported);
+    CHECK_FALSE(result.passed());
+    CHECK(result.mismatch_count == mismatches.size());
+    check_reported(result, mismatches, max_reported);
+  }
+
+  SECTION("Only the number of mismatches") {
+    const std::vector<std::size_t> mismatches{5, 77};
+    const auto result = compare_with_mismatches<Dims>(mismatches, 0);
+    CHECK(result.mismatch_count == mismatches.size());
+    check_reported(result, mismatches, 0);
+  }
+}
+
+}  // namespace handler_copy_verification
@@ -17,6 +17,11 @@ from modules import sycl_types
 from modules import sycl_functions
 from modules import test_generator
 
+# Number of test ids reserved for each signature and for each variant of a
+# test category
+ID_RANGE_PER_SIGNATURE = 100
+ID_RANGE_PER_VARIANT = 300000
+
 # Used to include types that are supported by implementation
 class runner:
     def __init__(self, marray):
@@ -63,8 +68,8 @@ def write_cases_to_file(generated_test_cases, inputFile, outputFile, extension=N
     with open(outputFile, 'w+') as output:
         output.write(newSource)
 
-def create_tests(test_id, types, signatures, template, file_name, extension, check = False):
-    generated_test_cases = test_generator.generate_test_cases(test_id, types, signatures, check)
+def create_tests(test_id, types, signatures, template, file_name, extension, check = False, batched = False):
+    generated_test_cases = test_generator.generate_test_cases(test_id, types, signatures, check, batched)
     write_cases_to_file(generated_test_cases, template, file_name, extension)
 
 def main():
@@ -90,6 +95,11 @@ def main():
         choices=['true', 'false'],
         default='false',
         help='Generate tests with marray function arguments')
+    argparser.add_argument(
+        '-batched',
+        choices=['true', 'false'],
+        default='false',
+        help='Run all checks of a file without pointer arguments in a single kernel')
     argparser.add_argument(
         '-print-output-files',
         action='store_true',
@@ -119,6 +129,7 @@ def main():
     expanded_types =  test_generator.expand_types(run, created_types)
 
     verifyResults = True
+    batched = (args.batched == 'true')
 
     test_signatures = []
     test_id_offset = 0
@@ -165,16 +176,24 @@ def main():
         test_signatures = base_signatures
     elif half_signatures and args.variante == 'half':
         test_signatures = half_signatures
-        test_id_offset = test_id_offset + 300000
+        test_id_offset = test_id_offset + ID_RANGE_PER_VARIANT
         extension = "fp16"
     elif double_signatures and args.variante == 'double':
         test_signatures = double_signatures
-        test_id_offset = test_id_offset + 600000
+        test_id_offset = test_id_offset + 2 * ID_RANGE_PER_VARIANT
         extension = "fp64"
     else:
         print("No %s overloads to generate for the test category" % args.variante)
         sys.exit(1)
 
+    # Test ids name the kernels of each test case and have to be unique within
+    # the test executable, which may compile several generated files within a
+    # single translation unit. Each signature reserves ID_RANGE_PER_SIGNATURE
+    # ids within the range of its category and variant.
+    if len(test_signatures) * ID_RANGE_PER_SIGNATURE > ID_RANGE_PER_VARIANT:
+        print("Too many %s signatures in test category %s for unique test ids" % (args.variante, args.test))
+        sys.exit(1)
+
     output_files = []
     if len(test_signatures) != 0:
         if not args.fragment_size:
@@ -188,13 +207,13 @@ def main():
         return
 
     if not args.fragment_size:
-        create_tests(test_id_offset, expanded_types, test_signatures, args.variante, args.template, output_files[0], extension, verifyResults)
+        create_tests(test_id_offset, expanded_types, test_signatures, args.template, output_files[0], extension, verifyResults, batched)
     else:
         for i in range(0, math.ceil(len(test_signatures) / args.fragment_size)):
             fragment_start = i * args.fragment_size
             fragment_end = fragment_start + args.fragment_size
-            current_offset = test_id_offset + fragment_start * 100
-            create_tests(current_offset, expanded_types, test_signatures[fragment_start:fragment_end], args.template, output_files[i], extension, verifyResults)
+            current_offset = test_id_offset + fragment_start * ID_RANGE_PER_SIGNATURE
+            create_tests(current_offset, expanded_types, test_signatures[fragment_start:fragment_end], args.template, output_files[i], extension, verifyResults, batched)
 
 if __name__ == "__main__":
     main()
@@ -16,8 +16,12 @@
 #include "../../util/sycl_exceptions.h"
 #include "../../util/type_traits.h"
 #include "../common/once_per_unit.h"
+#include <algorithm>
 #include <cfloat>
 #include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 template <int T>
 class kernel;
@@ -88,13 +92,17 @@ template <typename T>
 bool verify(sycl_cts::util::logger& log, T a, T b, float accuracy,
             AccuracyMode accuracy_mode, const std::string& comment);
 
+/**
+ * @brief Checks whether a result matches its reference within the given
+ *        accuracy, without logging anything. Safe to call from multiple threads.
+ */
 template <typename T>
-std::enable_if_t<is_sycl_scalar_floating_point_v<T>, bool> verify(
-    sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r,
-    float accuracy, AccuracyMode accuracy_mode, const std::string& comment) {
+std::enable_if_t<is_sycl_scalar_floating_point_v<T>, bool> is_accurate(
+    T value, const sycl_cts::resultRef<T>& r, float accuracy,
+    AccuracyMode accuracy_mode) {
   const T reference = r.res;
 
-  if (!r.undefined.empty())
+  if (r.undefined.any())
     return true;  // result is undefined according to spec
   if (std::isnan(value) && std::isnan(reference))
     return true;  // NaN can have any nancode within
@@ -125,9 +133,45 @@ std::enable_if_t<is_sycl_scalar_floating_point_v<T>, bool> verify(
       }
     }
   }
+  return false;
+}
+
+template <typename T>
+std::enable_if_t<std::is_integral_v<T>, bool> is_accurate(
+    T value, const sycl_cts::resultRef<T>& r, float, AccuracyMode) {
+  return value == r.res || r.undefined.any();
+}
+
+template <typename T, int N>
+bool is_accurate(const sycl::vec<T, N>& a,
+                 const sycl_cts::resultRef<sycl::vec<T, N>>& r, float accuracy,
+                 AccuracyMode accuracy_mode) {
+  for (int i = 0; i < N; i++)
+    if (!r.undefined.test(i) &&
+        !is_accurate<T>(a[i], r.res[i], accuracy, accuracy_mode))
+      return false;
+  return true;
+}
+
+template <typename T, size_t N>
+bool is_accurate(const sycl::marray<T, N>& a,
+                 const sycl_cts::resultRef<sycl::marray<T, N>>& r,
+                 float accuracy, AccuracyMode accuracy_mode) {
+  for (size_t i = 0; i < N; i++)
+    if (!r.undefined.test(i) &&
+        !is_accurate<T>(a[i], r.res[i], accuracy, accuracy_mode))
+      return false;
+  return true;
+}
+
+template <typename T>
+std::enable_if_t<is_sycl_scalar_floating_point_v<T>, bool> verify(
+    sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r,
+    float accuracy, AccuracyMode accuracy_mode, const std::string& comment) {
+  if (is_accurate(value, r, accuracy, accuracy_mode)) return true;
 
   log.note("value: " + printable(value) +
-           ", reference: " + printable(reference));
+           ", reference: " + printable(r.res));
   std::string msg = "Expected accuracy in " +
                     GetAccuracyModeStr(accuracy_mode) + ": " +
                     std::to_string(accuracy);
@@ -140,7 +184,7 @@ template <typename T>
 typename std::enable_if_t<std::is_integral_v<T>, bool> verify(
     sycl_cts::util::logger& log, T value, sycl_cts::resultRef<T> r, float,
     AccuracyMode, const std::string&) {
-  bool result = value == r.res || !r.undefined.empty();
+  bool result = is_accurate(value, r, 0.0f, AccuracyMode::ULP);
   if (!result)
     log.note("value: " + std::to_string(value) +
              ", reference: " + std::to_string(r.res));
@@ -153,7 +197,7 @@ bool verify(sycl_cts::util::logger& log, sycl::vec<T, N> a,
             AccuracyMode accuracy_mode, const std::string& comment) {
   sycl::vec<T, N> b = r.res;
   for (int i = 0; i < sycl_cts::math::numElements(a); i++)
-    if (r.undefined.find(i) == r.undefined.end() &&
+    if (!r.undefined.test(i) &&
         !verify(log, a[i], b[i], accuracy, accuracy_mode, comment))
       return false;
   return true;
@@ -165,7 +209,7 @@ bool verify(sycl_cts::util::logger& log, sycl::marray<T, N> a,
             AccuracyMode accuracy_mode, const std::string& comment) {
   sycl::marray<T, N> b = r.res;
   for (size_t i = 0; i < N; i++)
-    if (r.undefined.find(i) == r.undefined.end() &&
+    if (!r.undefined.test(i) &&
         !verify(log, a[i], b[i], accuracy, accuracy_mode, comment))
       return false;
   return true;
@@ -188,7 +232,7 @@ void check_function(sycl_cts::util::logger& log, funT fun,
   auto&& testQueue = once_per_unit::get_queue();
   try {
     sycl::buffer<returnT, 1> buffer(&kernelResult, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       h.single_task<kernel<N>>(
           [=]() { value_operations::assign(resultPtr[0], fun()); });
@@ -213,6 +257,151 @@ void check_function(sycl_cts::util::logger& log, funT fun,
   CHECK(verify(log, hostRes, ref, -1, accuracy_mode, comment));
 }
 
+/**
+ * @brief A generated check of a math function without pointer arguments,
+ *        executed together with the other checks of a generated file by
+ *        check_function_batch()
+ */
+template <typename returnT, typename funT>
+struct math_check {
+  using return_type = returnT;
+  using fun_type = funT;
+
+  int id;
+  funT fun;
+  sycl_cts::resultRef<returnT> ref;
+  float accuracy;
+  AccuracyMode accuracy_mode;
+  std::string comment;
+};
+
+template <typename returnT, typename funT>
+math_check<returnT, funT> make_math_check(
+    int id, funT fun, sycl_cts::resultRef<returnT> ref, float accuracy = 0.0f,
+    AccuracyMode accuracy_mode = AccuracyMode::ULP,
+    const std::string& comment = {}) {
+  return {id, fun, std::move(ref), accuracy, accuracy_mode, comment};
+}
+
+/** Object representation of a result in the byte array of a batch */
+template <typename T>
+struct result_bytes {
+  unsigned char bytes[sizeof(T)];
+};
+
+/**
+ * @brief Device copyable list of the functions of a batch of checks. Each
+ *        work-item runs the function with its index and stores the result at
+ *        the offset of the function in the result byte array.
+ */
+template <typename... checkT>
+struct batched_functions {
+  template <typename accessorT>
+  void run(size_t, size_t, const accessorT&) const {}
+};
+
+template <typename checkT, typename... restT>
+struct batched_functions<checkT, restT...> {
+  typename checkT::fun_type fun;
+  batched_functions<restT...> rest;
+
+  template <typename accessorT>
+  void run(size_t index, size_t offset, const accessorT& results) const {
+    using returnT = typename checkT::return_type;
+    if (index != 0) {
+      rest.run(index - 1, offset + sizeof(returnT), results);
+      return;
+    }
+    const returnT value = fun();
+    const auto representation = sycl::bit_cast<result_bytes<returnT>>(value);
+    for (size_t i = 0; i < sizeof(returnT); ++i)
+      results[offset + i] = representation.bytes[i];
+  }
+};
+
+inline batched_functions<> make_batched_functions() { return {}; }
+
+template <typename checkT, typename... restT>
+batched_functions<checkT, restT...> make_batched_functions(
+    const checkT& check, const restT&... rest) {
+  return {check.fun, make_batched_functions(rest...)};
+}
+
+/**
+ * @brief Verifies the device result of a single check of a batch, read from
+ *        the result byte array at the given offset, and its host result
+ * @return Whether the device result matches the reference
+ */
+template <typename checkT>
+bool verify_batched_check(sycl_cts::util::logger& log, const checkT& check,
+                          const unsigned char* results, size_t& offset) {
+  using returnT = typename checkT::return_type;
+  result_bytes<returnT> representation;
+  std::copy(results + offset, results + offset + sizeof(returnT),
+            representation.bytes);
+  offset += sizeof(returnT);
+  const auto kernelResult = sycl::bit_cast<returnT>(representation);
+
+  const bool passed = verify(log, kernelResult, check.ref, check.accuracy,
+                             check.accuracy_mode, check.comment);
+  if (!passed)
+    log.note("tests case: " + std::to_string(check.id) +
+             ". Correctness check failed.");
+
+  // host check
+  auto hostRes = check.fun();
+  INFO("tests case: " + std::to_string(check.id) +
+       ". Correctness check failed on host.");
+  // SYCL 2020 specification sets no requirements for math built-ins accuracy
+  // on host, hence passing negative value to 'verify' helper to indicate that.
+  CHECK(verify(log, hostRes, check.ref, -1, check.accuracy_mode,
+               check.comment));
+  return passed;
+}
+
+/**
+ * @brief Runs a batch of checks in a single kernel, one work-item per check,
+ *        and verifies all results after a single read back
+ *
+ * Equivalent to calling check_function() for each check, without the launch
+ * and synchronization overhead of one kernel per check.
+ * @tparam N Unique id naming the kernel of the batch
+ */
+template <int N, typename... checkT>
+void check_function_batch(sycl_cts::util::logger& log,
+                          const checkT&... checks) {
+  constexpr size_t count = sizeof...(checkT);
+  std::vector<unsigned char> results(
+      (sizeof(typename checkT::return_type) + ...));
+  const auto functions = make_batched_functions(checks...);
+  auto&& testQueue = once_per_unit::get_queue();
+  try {
+    sycl::buffer<unsigned char, 1> buffer(results.data(),
+                                          sycl::range<1>(results.size()));
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
+      auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
+      h.parallel_for<kernel<N>>(sycl::range<1>(count), [=](sycl::id<1> id) {
+        functions.run(id[0], 0, resultPtr);
+      });
+    });
+  } catch (const sycl::exception& e) {
+    log_exception(log, e);
+    std::string errorMsg = "batch of " + std::to_string(count) +
+                           " tests cases starting at " + std::to_string(N) +
+                           " a SYCL exception was caught: " + e.what();
+    FAIL(log, errorMsg.c_str());
+  }
+
+  size_t offset = 0;
+  size_t failed = 0;
+  ((failed += !verify_batched_check(log, checks, results.data(), offset)),
+   ...);
+  if (failed != 0)
+    FAIL(log, std::to_string(failed) + " of " + std::to_string(count) +
+                  " tests cases in batch starting at " + std::to_string(N) +
+                  ". Correctness check failed.");
+}
+
 template <int N, typename returnT, typename funT, typename argT>
 void check_function_ptr_private(sycl_cts::util::logger& log, funT fun,
                                 sycl_cts::resultRef<returnT> ref, argT ptrRef,
@@ -226,7 +415,7 @@ void check_function_ptr_private(sycl_cts::util::logger& log, funT fun,
   try {
     sycl::buffer<returnT, 1> buffer(&kernelResult, ndRng);
     sycl::buffer<argT, 1> bufferArg(&kernelResultArg, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       auto resultPtrArg =
           bufferArg.template get_access<sycl::access_mode::write>(h);
@@ -277,7 +466,7 @@ void check_function_ptr_global(sycl_cts::util::logger& log, funT fun, argT arg,
   try {
     sycl::buffer<returnT, 1> buffer(&kernelResult, ndRng);
     sycl::buffer<argT, 1> ptrBuffer(&arg, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       sycl::accessor<argT, 1, sycl::access_mode::read_write,
                      sycl::target::device>
@@ -311,7 +500,7 @@ void check_function_ptr_local(sycl_cts::util::logger& log, funT fun, argT arg,
   try {
     sycl::buffer<returnT, 1> buffer(&kernelResult, ndRng);
     sycl::buffer<argT, 1> bufferArg(&arg, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       auto resultPtrArg =
           bufferArg.template get_access<sycl::access_mode::write>(h);
@@ -346,7 +535,7 @@ void test_function(funT fun) {
   auto&& testQueue = once_per_unit::get_queue();
   {
     sycl::buffer<returnT, 1> buffer(kernelResult, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       h.single_task<kernel<T>>([=]() { resultPtr[0] = fun(); });
     });
@@ -363,7 +552,7 @@ void test_function_ptr_global(funT fun, argT arg) {
   {
     sycl::buffer<returnT, 1> buffer(kernelResult, ndRng);
     sycl::buffer<argT, 1> ptrBuffer(&arg, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       sycl::accessor<argT, 1, sycl::access_mode::read_write,
                      sycl::target::device>
@@ -382,7 +571,7 @@ void test_function_ptr_local(funT fun, argT arg) {
   auto&& testQueue = once_per_unit::get_queue();
   {
     sycl::buffer<returnT, 1> buffer(kernelResult, ndRng);
-    testQueue.submit([&](sycl::handler& h) {
+    sycl_cts::util::submit_and_record(testQueue, [&](sycl::handler& h) {
       auto resultPtr = buffer.template get_access<sycl::access_mode::write>(h);
       sycl::accessor<argT, 1, sycl::access_mode::read_write,
                      sycl::target::local>
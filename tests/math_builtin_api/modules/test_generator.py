@@ -53,6 +53,16 @@ test_case_templates_check = {
         $FUNCTION_CALL
       }, ref$ACCURACY$COMMENT);
 }
+"""),
+
+    "batched" : ("""
+auto check_$TEST_ID = []{
+  $REFERENCE
+  return make_math_check<$RETURN_TYPE>($TEST_ID,
+      [=]{
+        $FUNCTION_CALL
+      }, ref$ACCURACY$COMMENT);
+}();
 """),
 
     "private" : ("""
@@ -352,7 +362,7 @@ def generate_test_case(test_id, types, sig, memory, check, decorated_or_raw = ""
     else:
         testCaseSource = testCaseSource.replace("$COMMENT", "")
 
-    if memory != "private" and memory !="no_ptr":
+    if memory != "private" and memory != "no_ptr" and memory != "batched":
         # We rely on the fact that all SYCL math builtins have at most one arguments as pointer.
         pointerType = sig.arg_types[sig.pntr_indx[0] - 1]
         sourcePtrDataName = "ptrSourceData"
@@ -368,9 +378,16 @@ def generate_test_case(test_id, types, sig, memory, check, decorated_or_raw = ""
     testCaseSource = testCaseSource.replace("$FUNCTION_CALL", generate_function_call(sig, arg_names, arg_src))
     return testCaseSource
 
-def generate_test_cases(test_id, types, sig_list, check):
+batch_call_template = Template("""
+check_function_batch<${test_id}>(log, ${checks});
+""")
+
+def generate_test_cases(test_id, types, sig_list, check, batched=False):
     random.seed(0)
     test_source = ""
+    # Ids of the checks without pointer arguments that are executed together
+    # in a single kernel in batched mode. The kernel is named by the first id.
+    batched_ids = []
     decorated_yes = "sycl::access::decorated::yes"
     decorated_no = "sycl::access::decorated::no"
     for sig in sig_list:
@@ -394,12 +411,20 @@ def generate_test_cases(test_id, types, sig_list, check):
             test_source += generate_test_case(test_id, types, sig, "global", check, "raw")
             test_id += 1
         else:
-            if check:
+            if check and batched:
+                test_source += generate_test_case(test_id, types, sig, "batched", check)
+                batched_ids.append(test_id)
+                test_id += 1
+            elif check:
                 test_source += generate_test_case(test_id, types, sig, "no_ptr", check)
                 test_id += 1
             else:
                 test_source += generate_test_case(test_id, types, sig, "private", check)
                 test_id += 1
+    if batched_ids:
+        test_source += batch_call_template.substitute(
+            test_id=batched_ids[0],
+            checks=", ".join("check_" + str(i) for i in batched_ids))
     return test_source
 
 # Lists of the types with equal sizes
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+# ************************************************************************
+#
+#   SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+#   SPDX-License-Identifier: Apache-2.0
+#
+#   SYCL Conformance Test Suite
+#
+# ************************************************************************
+
+import argparse
+import math
+import os
+import sys
+sys.path.append('../common/')
+from common_python_corpus import (FORMATS, binade_values, cross, make_rng,
+                                  near, neighbors, random_bits,
+                                  random_log_uniform, random_uniform,
+                                  special_values, write_corpus)
+
+# Number of ulps sampled on each side of a hard point
+RADIUS = 8
+
+
+def largest(fmt):
+    return fmt.from_bits(fmt.infinity - 1)
+
+
+def smallest(fmt):
+    return fmt.from_bits(1)
+
+
+def pi_multiples(fmt):
+    """Multiples of pi / 2, where argument reduction loses most precision"""
+    values = [k * math.pi / 2 for k in range(-256, 257)]
+    values += [math.ldexp(math.pi, e) for e in range(8, fmt.max_exponent() - 1)]
+    return values
+
+
+def exp_limits(fmt, base):
+    """Arguments for which base^x overflows or underflows"""
+    log = lambda x: math.log(x, base) if base != math.e else math.log(x)
+    return [log(largest(fmt)), log(smallest(fmt)),
+            log(fmt.from_bits(fmt.power_of_two(1 - fmt.exponent_bias)))]
+
+
+# Hard points of the unary builtins, together with the interval random inputs
+# are sampled from in addition to random bit patterns
+def unary_hard_points(name, fmt):
+    if name in ('sqrt', 'rsqrt'):
+        return [k * k for k in range(1, 129)], (0, 1e4)
+    if name == 'cbrt':
+        return [k ** 3 for k in range(-64, 65)], (-1e4, 1e4)
+    if name == 'exp':
+        return (exp_limits(fmt, math.e) +
+                [k * math.log(2) for k in range(-64, 65)]), (-100, 100)
+    if name == 'exp2':
+        return (exp_limits(fmt, 2) +
+                [k / 2 for k in range(-300, 300)]), (-150, 150)
+    if name == 'expm1':
+        return (exp_limits(fmt, math.e) +
+                [-math.log(2), math.log(2)]), (-20, 20)
+    if name in ('log', 'log2'):
+        return [math.exp(k) for k in range(-80, 81)] + [1.0], (0, 1e4)
+    if name == 'log1p':
+        return [-1.0, 0.0, math.e - 1], (-1, 10)
+    if name in ('sin', 'cos', 'tan'):
+        return pi_multiples(fmt), (-1e4, 1e4)
+    if name == 'atan':
+        return [-1.0, 1.0], (-100, 100)
+    if name in ('sinh', 'cosh'):
+        overflow = math.log(largest(fmt)) + math.log(2)
+        return [-overflow, overflow], (-100, 100)
+    if name == 'tanh':
+        # tanh rounds to +-1 beyond these magnitudes
+        return [-9.0, 9.0, -19.0, 19.0], (-20, 20)
+    raise ValueError(name)
+
+
+def unary_corpus(name, fmt, size):
+    rng = make_rng(name + fmt.name)
+    hard_points, (low, high) = unary_hard_points(name, fmt)
+    x = special_values(fmt) + binade_values(fmt) + near(fmt, hard_points,
+                                                        RADIUS)
+    x += random_bits(rng, fmt, size // 4)
+    x += random_log_uniform(rng, fmt, size // 4, fmt.min_exponent(),
+                            fmt.max_exponent())
+    x += random_uniform(rng, fmt, size - 2 * (size // 4), low, high)
+    return [x]
+
+
+def pow_corpus(fmt, size):
+    rng = make_rng('pow' + fmt.name)
+    args = cross(special_values(fmt), special_values(fmt))
+    # x close to one with large y, negative x with integer y, and results
+    # close to overflow and underflow
+    x_near_one = near(fmt, [1.0], RADIUS * 4)
+    large_y = [fmt.power_of_two(e, n) for e in range(4, fmt.max_exponent())
+               for n in (False, True)]
+    integers = [fmt.to_bits(float(k)) for k in range(-9, 10)] + [
+        fmt.to_bits(math.ldexp(1.0, fmt.mantissa_bits) + 1)]
+    halves = [fmt.to_bits(v) for v in (-0.5, 0.5, -1.5, 1.5)]
+    negative_x = [fmt.to_bits(-v) for v in (0.5, 2.0, 3.0, 10.0)]
+    for pairs in (cross(x_near_one, large_y), cross(negative_x, integers),
+                  cross(near(fmt, [2.0, 0.5, 10.0], RADIUS),
+                        integers + halves)):
+        args[0] += pairs[0]
+        args[1] += pairs[1]
+    for boundary in (fmt.max_exponent(), fmt.min_exponent()):
+        for y in range(1, 64):
+            args[0] += neighbors(fmt, fmt.to_bits(2.0 ** (boundary / y)),
+                                 RADIUS)
+            args[1] += [fmt.to_bits(float(y))] * (2 * RADIUS + 1)
+
+    random_count = size // 2
+    args[0] += random_bits(rng, fmt, random_count)
+    args[1] += random_bits(rng, fmt, random_count)
+    args[0] += random_uniform(rng, fmt, size - random_count, 0, 4)
+    args[1] += random_uniform(rng, fmt, size - random_count, -100, 100)
+    return args
+
+
+def atan2_corpus(fmt, size):
+    rng = make_rng('atan2' + fmt.name)
+    args = cross(special_values(fmt), special_values(fmt))
+    # y / x close to +-1, where the result is close to a multiple of pi / 4
+    for _ in range(size // 4):
+        y = random_log_uniform(rng, fmt, 1, -20, 20)[0]
+        x = neighbors(fmt, y ^ (fmt.sign if rng.random() < 0.5 else 0),
+                      RADIUS)
+        args[0] += [y] * len(x)
+        args[1] += x
+    args[0] += random_bits(rng, fmt, size)
+    args[1] += random_bits(rng, fmt, size)
+    return args
+
+
+def hypot_corpus(fmt, size):
+    rng = make_rng('hypot' + fmt.name)
+    args = cross(special_values(fmt), special_values(fmt))
+    # Squares that overflow or underflow, although the result does not
+    for scale in (largest(fmt) / 2, smallest(fmt) * 2 ** fmt.mantissa_bits):
+        values = near(fmt, [scale, scale / 3], RADIUS)
+        pairs = cross(values, values)
+        args[0] += pairs[0]
+        args[1] += pairs[1]
+    args[0] += random_bits(rng, fmt, size)
+    args[1] += random_bits(rng, fmt, size)
+    return args
+
+
+def fma_corpus(fmt, size):
+    rng = make_rng('fma' + fmt.name)
+    specials = special_values(fmt)
+    args = cross(specials, specials, specials)
+    # Addends cancelling the product, so that the result depends on the
+    # low-order bits of the exact product
+    for _ in range(size // 2):
+        a, b = random_log_uniform(rng, fmt, 2, -40, 40)
+        product = fmt.from_bits(a) * fmt.from_bits(b)
+        c = neighbors(fmt, fmt.to_bits(-product), 2)
+        args[0] += [a] * len(c)
+        args[1] += [b] * len(c)
+        args[2] += c
+    for values in args:
+        values += random_bits(rng, fmt, size // 2)
+    return args
+
+
+UNARY = ['sqrt', 'rsqrt', 'cbrt', 'exp', 'exp2', 'expm1', 'log', 'log2',
+         'log1p', 'sin', 'cos', 'tan', 'atan', 'sinh', 'cosh', 'tanh']
+MULTIARY = {'pow': pow_corpus, 'atan2': atan2_corpus, 'hypot': hypot_corpus,
+            'fma': fma_corpus}
+
+
+def main():
+    argparser = argparse.ArgumentParser(
+        description='Generates the input corpora of the math_corpus tests')
+    argparser.add_argument('-output-dir', required=True,
+                           help='Directory to write the corpus files to')
+    argparser.add_argument('-types', nargs='+', default=['float', 'double'],
+                           choices=['half', 'float', 'double'])
+    argparser.add_argument('-size', type=int, default=65536,
+                           help='Number of random inputs per corpus')
+    argparser.add_argument('-print-output-files', action='store_true',
+                           help='Print the files that would be generated')
+    args = argparser.parse_args()
+
+    outputs = []
+    for type_name in args.types:
+        for name in UNARY + list(MULTIARY):
+            path = os.path.join(args.output_dir,
+                                name + '_' + type_name + '.bin')
+            outputs.append((path, name, FORMATS[type_name]))
+
+    if args.print_output_files:
+        print(';'.join(path for path, _, _ in outputs))
+        return
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    for path, name, fmt in outputs:
+        if name in MULTIARY:
+            corpus = MULTIARY[name](fmt, args.size)
+        else:
+            corpus = unary_corpus(name, fmt, args.size)
+        write_corpus(path, fmt, corpus)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,414 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Accuracy checks of math builtins on edge-case-weighted input corpora
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_MATH_CORPUS_COMMON_H
+#define __SYCLCTS_TESTS_MATH_CORPUS_COMMON_H
+
+#include "../../oclmath/Utility.h"
+#include "../../oclmath/reference_math.h"
+#include "../../util/host_thread_pool.h"
+#include "../../util/input_corpus.h"
+#include "../../util/math_reference_batch.h"
+#include "../../util/math_reference_simd.h"
+#include "../../util/random.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace math_corpus {
+using namespace sycl_cts;
+
+template <typename T>
+struct fp_traits;
+
+template <>
+struct fp_traits<float> {
+  using bits_t = std::uint32_t;
+  static constexpr double min_normal = 0x1p-126;
+  static sycl::info::device::single_fp_config::return_type get_fp_config(
+      const sycl::device& device) {
+    return device.get_info<sycl::info::device::single_fp_config>();
+  }
+
+  /**
+   * @brief Error in ulp following the OpenCL CTS: correctly rounded results
+   *        have no error at all
+   */
+  static float ulp_error(float test, double reference) {
+    if (std::isnan(reference)) {
+      return std::isnan(test) ? 0.0f : std::numeric_limits<float>::infinity();
+    }
+    if (std::isnan(test)) return std::numeric_limits<float>::infinity();
+    if (static_cast<float>(reference) == test) return 0.0f;
+    return std::fabs(Ulp_Error(test, reference));
+  }
+};
+
+template <>
+struct fp_traits<double> {
+  using bits_t = std::uint64_t;
+  static constexpr double min_normal = 0x1p-1022;
+  static sycl::info::device::double_fp_config::return_type get_fp_config(
+      const sycl::device& device) {
+    return device.get_info<sycl::info::device::double_fp_config>();
+  }
+
+  static float ulp_error(double test, long double reference) {
+    if (std::isnan(reference)) {
+      return std::isnan(test) ? 0.0f : std::numeric_limits<float>::infinity();
+    }
+    if (std::isnan(test)) return std::numeric_limits<float>::infinity();
+    if (static_cast<double>(reference) == test) return 0.0f;
+    return std::fabs(Ulp_Error_Double(test, reference));
+  }
+};
+
+/**
+ * @brief Defines a builtin to check, together with its oclmath references and
+ *        its maximum error in ulp for float and double as given by the
+ *        specification. Unused arguments of `apply` and `reference` are
+ *        ignored.
+ */
+#define MATH_CORPUS_UNARY_BUILTIN(NAME, FLOAT_ULP, DOUBLE_ULP)         \
+  struct NAME##_builtin {                                              \
+    static constexpr const char* name = #NAME;                         \
+    static constexpr std::size_t arity = 1;                            \
+    static constexpr float float_ulp = FLOAT_ULP;                      \
+    static constexpr float double_ulp = DOUBLE_ULP;                    \
+    template <typename T>                                              \
+    static T apply(T x, T, T) {                                        \
+      return sycl::NAME(x);                                            \
+    }                                                                  \
+    static double reference(float x, float, float) {                   \
+      return reference_##NAME(x);                                      \
+    }                                                                  \
+    static long double reference(double x, double, double) {           \
+      return reference_##NAME##l(x);                                   \
+    }                                                                  \
+  };
+
+#define MATH_CORPUS_BINARY_BUILTIN(NAME, FLOAT_ULP, DOUBLE_ULP)        \
+  struct NAME##_builtin {                                              \
+    static constexpr const char* name = #NAME;                         \
+    static constexpr std::size_t arity = 2;                            \
+    static constexpr float float_ulp = FLOAT_ULP;                      \
+    static constexpr float double_ulp = DOUBLE_ULP;                    \
+    template <typename T>                                              \
+    static T apply(T x, T y, T) {                                      \
+      return sycl::NAME(x, y);                                         \
+    }                                                                  \
+    static double reference(float x, float y, float) {                 \
+      return reference_##NAME(x, y);                                   \
+    }                                                                  \
+    static long double reference(double x, double y, double) {         \
+      return reference_##NAME##l(x, y);                                \
+    }                                                                  \
+  };
+
+MATH_CORPUS_UNARY_BUILTIN(sqrt, 3, 0)
+MATH_CORPUS_UNARY_BUILTIN(rsqrt, 2, 2)
+MATH_CORPUS_UNARY_BUILTIN(cbrt, 2, 2)
+MATH_CORPUS_UNARY_BUILTIN(exp, 3, 3)
+MATH_CORPUS_UNARY_BUILTIN(exp2, 3, 3)
+MATH_CORPUS_UNARY_BUILTIN(expm1, 3, 3)
+MATH_CORPUS_UNARY_BUILTIN(log, 3, 3)
+MATH_CORPUS_UNARY_BUILTIN(log2, 3, 3)
+MATH_CORPUS_UNARY_BUILTIN(log1p, 2, 2)
+MATH_CORPUS_UNARY_BUILTIN(sin, 4, 4)
+MATH_CORPUS_UNARY_BUILTIN(cos, 4, 4)
+MATH_CORPUS_UNARY_BUILTIN(tan, 5, 5)
+MATH_CORPUS_UNARY_BUILTIN(atan, 5, 5)
+MATH_CORPUS_UNARY_BUILTIN(sinh, 4, 4)
+MATH_CORPUS_UNARY_BUILTIN(cosh, 4, 4)
+MATH_CORPUS_UNARY_BUILTIN(tanh, 5, 5)
+MATH_CORPUS_BINARY_BUILTIN(pow, 16, 16)
+MATH_CORPUS_BINARY_BUILTIN(atan2, 6, 6)
+MATH_CORPUS_BINARY_BUILTIN(hypot, 4, 4)
+
+#undef MATH_CORPUS_UNARY_BUILTIN
+#undef MATH_CORPUS_BINARY_BUILTIN
+
+/** fma has to be correctly rounded, its float reference is exact */
+struct fma_builtin {
+  static constexpr const char* name = "fma";
+  static constexpr std::size_t arity = 3;
+  static constexpr float float_ulp = 0;
+  static constexpr float double_ulp = 0;
+  template <typename T>
+  static T apply(T x, T y, T z) {
+    return sycl::fma(x, y, z);
+  }
+  static double reference(float x, float y, float z) {
+    return reference_fma(x, y, z, 0);
+  }
+  static long double reference(double x, double y, double z) {
+    return reference_fmal(x, y, z);
+  }
+};
+
+template <typename T, typename BuiltinT>
+class corpus_kernel;
+
+template <typename T, typename BuiltinT>
+constexpr float max_ulp =
+    std::is_same_v<T, float> ? BuiltinT::float_ulp : BuiltinT::double_ulp;
+
+/**
+ * @brief Largest error found within a range of inputs
+ */
+struct check_result {
+  float max_error = 0;
+  std::size_t worst_input = 0;
+  std::size_t failures = 0;
+
+  void merge(const check_result& other) {
+    if (other.max_error > max_error) {
+      max_error = other.max_error;
+      worst_input = other.worst_input;
+    }
+    failures += other.failures;
+  }
+};
+
+/** Flushes subnormal values to zero, keeping their sign */
+template <typename T>
+T flush(T x) {
+  return std::fabs(x) < fp_traits<T>::min_normal ? std::copysign(T(0), x) : x;
+}
+
+/** Result type of the reference of a builtin for arguments of type T */
+template <typename T, typename BuiltinT>
+using reference_t = decltype(BuiltinT::reference(T{}, T{}, T{}));
+
+/**
+ * @brief Computes the error of a single device result, given the reference
+ *        for its input. Devices without denormal support may flush subnormal
+ *        inputs and results to zero.
+ */
+template <typename T, typename BuiltinT>
+float get_error(T x, T y, T z, T result, reference_t<T, BuiltinT> reference,
+                bool denorm_supported) {
+  using traits = fp_traits<T>;
+  float error = traits::ulp_error(result, reference);
+  if (denorm_supported || error == 0.0f) return error;
+
+  if (result == T(0) && std::fabs(reference) < traits::min_normal) {
+    return 0.0f;
+  }
+  if (flush(x) != x || flush(y) != y || flush(z) != z) {
+    error = std::min(error,
+                     traits::ulp_error(result, BuiltinT::reference(
+                                                   flush(x), flush(y),
+                                                   flush(z))));
+  }
+  return error;
+}
+
+/** Bit pattern of every argument of an input, for the report */
+template <typename T>
+std::string format_input(const T* const* arguments, std::size_t arity,
+                         std::size_t index) {
+  std::ostringstream stream;
+  stream << std::hex << std::setfill('0');
+  for (std::size_t a = 0; a < arity; ++a) {
+    typename fp_traits<T>::bits_t bits;
+    std::memcpy(&bits, &arguments[a][index], sizeof(bits));
+    stream << (a > 0 ? ", " : "") << "0x" << std::setw(sizeof(T) * 2) << bits;
+  }
+  return stream.str();
+}
+
+/** Number of random inputs checked in addition to each corpus */
+constexpr std::size_t random_input_count = std::size_t{1} << 18;
+
+/**
+ * @brief Evaluates the oclmath reference of the builtin for `count` inputs on
+ *        all host threads
+ */
+template <typename T, typename BuiltinT>
+std::vector<reference_t<T, BuiltinT>> evaluate_references(
+    const T* const* arguments, std::size_t count) {
+  std::vector<reference_t<T, BuiltinT>> references(count);
+  if constexpr (std::is_same_v<T, float> &&
+                std::is_same_v<BuiltinT, fma_builtin>) {
+    // The float reference of fma has a vectorized array version
+    util::get<util::host_thread_pool>().parallel_for(
+        count, [&](std::size_t begin, std::size_t end) {
+          math::reference_fma_batch(arguments[0] + begin, arguments[1] + begin,
+                                    arguments[2] + begin,
+                                    references.data() + begin, end - begin);
+        });
+  } else if constexpr (BuiltinT::arity == 1) {
+    math::evaluate_reference_batch(
+        [](T x) { return BuiltinT::reference(x, T(0), T(0)); }, count,
+        references.data(), arguments[0]);
+  } else if constexpr (BuiltinT::arity == 2) {
+    math::evaluate_reference_batch(
+        [](T x, T y) { return BuiltinT::reference(x, y, T(0)); }, count,
+        references.data(), arguments[0], arguments[1]);
+  } else {
+    math::evaluate_reference_batch(
+        [](T x, T y, T z) { return BuiltinT::reference(x, y, z); }, count,
+        references.data(), arguments[0], arguments[1], arguments[2]);
+  }
+  return references;
+}
+
+/**
+ * @brief Runs the builtin on `count` inputs on the device and compares each
+ *        result against the oclmath reference. The references are evaluated
+ *        on all host threads while the device computes the results. The
+ *        arrays of all arguments have to be contiguous.
+ */
+template <typename T, typename BuiltinT>
+check_result check_inputs(const T* const* arguments, std::size_t count,
+                          bool denorm_supported) {
+  constexpr std::size_t arity = BuiltinT::arity;
+  constexpr float allowed_error = max_ulp<T, BuiltinT>;
+  auto& queue = once_per_unit::get_queue();
+  sycl::buffer<T, 1> inputs{arguments[0], sycl::range<1>(arity * count)};
+  sycl::buffer<T, 1> outputs{sycl::range<1>(count)};
+  util::submit_and_record(queue, [&](sycl::handler& cgh) {
+    sycl::accessor in{inputs, cgh, sycl::read_only};
+    sycl::accessor out{outputs, cgh, sycl::write_only, sycl::no_init};
+    cgh.parallel_for<corpus_kernel<T, BuiltinT>>(
+        sycl::range<1>(count), [=](sycl::id<1> id) {
+          const std::size_t i = id[0];
+          const T x = in[i];
+          const T y = arity > 1 ? in[count + i] : T(0);
+          const T z = arity > 2 ? in[2 * count + i] : T(0);
+          out[id] = BuiltinT::apply(x, y, z);
+        });
+  });
+
+  const auto references = evaluate_references<T, BuiltinT>(arguments, count);
+  sycl::host_accessor results{outputs, sycl::read_only};
+  check_result result;
+  std::mutex result_mutex;
+  util::get<util::host_thread_pool>().parallel_for(
+      count, [&](std::size_t begin, std::size_t end) {
+        check_result local;
+        for (std::size_t i = begin; i < end; ++i) {
+          const T x = arguments[0][i];
+          const T y = arity > 1 ? arguments[1][i] : T(0);
+          const T z = arity > 2 ? arguments[2][i] : T(0);
+          const float error = get_error<T, BuiltinT>(
+              x, y, z, results[i], references[i], denorm_supported);
+          if (error > allowed_error) ++local.failures;
+          if (error > local.max_error) {
+            local.max_error = error;
+            local.worst_input = i;
+          }
+        }
+        std::lock_guard<std::mutex> lock(result_mutex);
+        result.merge(local);
+      });
+  return result;
+}
+
+/**
+ * @brief Checks the builtin on every input of its corpus, followed by
+ *        `random_input_count` random bit patterns derived from `--seed`
+ */
+template <typename T, typename BuiltinT>
+void check(const std::string& type_name) {
+  constexpr std::size_t arity = BuiltinT::arity;
+  constexpr float allowed_error = max_ulp<T, BuiltinT>;
+  const auto corpus =
+      util::input_corpus::open(std::string(BuiltinT::name) + "_" + type_name);
+  REQUIRE(corpus.get_arity() == arity);
+  const T* corpus_arguments[3] = {};
+  for (std::size_t a = 0; a < arity; ++a) {
+    corpus_arguments[a] = corpus.template get_argument<T>(a);
+  }
+
+  std::vector<T> random_inputs(arity * random_input_count);
+  util::fill_random_bits(util::counter_rng::from_config(),
+                         random_inputs.data(), random_inputs.size());
+  const T* random_arguments[3] = {};
+  for (std::size_t a = 0; a < arity; ++a) {
+    random_arguments[a] = random_inputs.data() + a * random_input_count;
+  }
+
+  const auto fp_config =
+      fp_traits<T>::get_fp_config(once_per_unit::get_queue().get_device());
+  const bool denorm_supported =
+      std::find(fp_config.begin(), fp_config.end(),
+                sycl::info::fp_config::denorm) != fp_config.end();
+
+  auto check_and_report = [&](const std::string& description,
+                              const T* const* arguments, std::size_t count) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto result =
+        check_inputs<T, BuiltinT>(arguments, count, denorm_supported);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    WARN("sycl::" << BuiltinT::name << "(" << type_name << "), "
+                  << description << ": max error " << result.max_error
+                  << " ulp at input ("
+                  << format_input(arguments, arity, result.worst_input)
+                  << ") (allowed " << allowed_error << " ulp), "
+                  << result.failures << " of " << count
+                  << " inputs exceed the allowed error, " << elapsed.count()
+                  << " s");
+    CHECK(result.failures == 0);
+  };
+  check_and_report("corpus", corpus_arguments, corpus.size());
+  check_and_report(
+      "random inputs with seed " +
+          std::to_string(util::get<util::random_config>().get_seed()),
+      random_arguments, random_input_count);
+}
+
+/**
+ * @brief Checks all given builtins, each one in its own section
+ */
+template <typename T, typename... BuiltinsT>
+void check_all(const std::string& type_name) {
+  ((
+       [&] {
+         SECTION(std::string("sycl::") + BuiltinsT::name) {
+           check<T, BuiltinsT>(type_name);
+         }
+       }()),
+   ...);
+}
+
+/**
+ * @brief Checks every builtin defined in this header
+ */
+template <typename T>
+void check_all_builtins(const std::string& type_name) {
+  check_all<T, sqrt_builtin, rsqrt_builtin, cbrt_builtin, exp_builtin,
+            exp2_builtin, expm1_builtin, log_builtin, log2_builtin,
+            log1p_builtin, sin_builtin, cos_builtin, tan_builtin,
+            atan_builtin, sinh_builtin, cosh_builtin, tanh_builtin,
+            pow_builtin, atan2_builtin, hypot_builtin, fma_builtin>(
+      type_name);
+}
+
+}  // namespace math_corpus
+
+#endif  // __SYCLCTS_TESTS_MATH_CORPUS_COMMON_H
@@ -0,0 +1,21 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "math_corpus_common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace math_corpus_core {
+
+TEST_CASE("Accuracy of math builtins on the input corpus. float",
+          "[math_corpus]") {
+  math_corpus::check_all_builtins<float>("float");
+}
+
+}  // namespace math_corpus_core
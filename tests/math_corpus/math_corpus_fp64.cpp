@@ -0,0 +1,25 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "math_corpus_common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace math_corpus_fp64 {
+
+TEST_CASE("Accuracy of math builtins on the input corpus. double",
+          "[math_corpus]") {
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp64)) {
+    SKIP("Device does not support double precision floating point operations");
+  }
+  math_corpus::check_all_builtins<double>("double");
+}
+
+}  // namespace math_corpus_fp64
@@ -0,0 +1,111 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Checks the array versions of the math references against the scalar ones
+//
+*******************************************************************************/
+
+#include "math_corpus_common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+namespace math_corpus_reference {
+using namespace sycl_cts;
+
+/**
+ * Number of inputs of each check. Not a multiple of the vector width, so the
+ * scalar tail of the vectorized code paths is covered as well.
+ */
+constexpr std::size_t input_count = (std::size_t{1} << 16) + 7;
+
+/** Special values, followed by random bit patterns derived from `--seed` */
+std::vector<float> get_inputs(std::uint64_t stream) {
+  std::vector<float> inputs(input_count);
+  util::fill_random_bits(util::counter_rng::from_config(stream), inputs.data(),
+                         inputs.size());
+  const float specials[] = {0.0f,
+                            -0.0f,
+                            1.0f,
+                            -1.0f,
+                            INFINITY,
+                            -INFINITY,
+                            NAN,
+                            FLT_MIN,
+                            -FLT_MIN,
+                            FLT_MAX,
+                            -FLT_MAX,
+                            0x1p-149f};
+  std::copy(std::begin(specials), std::end(specials), inputs.begin());
+  return inputs;
+}
+
+/** Index of the first result differing in its bit pattern, or `count` */
+std::size_t first_difference(const double* a, const double* b,
+                             std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    if (std::memcmp(&a[i], &b[i], sizeof(double)) != 0) return i;
+  }
+  return count;
+}
+
+TEST_CASE("Array versions of the math references match the scalar ones",
+          "[math_corpus]") {
+  const auto x = get_inputs(0);
+  std::vector<double> expected(input_count);
+  std::vector<double> actual(input_count);
+
+  SECTION("sqrt") {
+    INFO("vectorized: "
+         << math::is_simd_reference_vectorized(math::simd_reference::sqrt));
+    for (std::size_t i = 0; i < input_count; ++i) {
+      expected[i] = reference_sqrt(x[i]);
+    }
+    math::reference_sqrt_batch(x.data(), actual.data(), input_count);
+    const auto i = first_difference(expected.data(), actual.data(),
+                                    input_count);
+    INFO("first difference at index " << i);
+    CHECK(i == input_count);
+  }
+
+  SECTION("rsqrt") {
+    INFO("vectorized: "
+         << math::is_simd_reference_vectorized(math::simd_reference::rsqrt));
+    for (std::size_t i = 0; i < input_count; ++i) {
+      expected[i] = reference_rsqrt(x[i]);
+    }
+    math::reference_rsqrt_batch(x.data(), actual.data(), input_count);
+    const auto i = first_difference(expected.data(), actual.data(),
+                                    input_count);
+    INFO("first difference at index " << i);
+    CHECK(i == input_count);
+  }
+
+  SECTION("fma") {
+    INFO("vectorized: "
+         << math::is_simd_reference_vectorized(math::simd_reference::fma));
+    const auto y = get_inputs(1);
+    const auto z = get_inputs(2);
+    for (std::size_t i = 0; i < input_count; ++i) {
+      expected[i] = reference_fma(x[i], y[i], z[i], 0);
+    }
+    math::reference_fma_batch(x.data(), y.data(), z.data(), actual.data(),
+                              input_count);
+    const auto i = first_difference(expected.data(), actual.data(),
+                                    input_count);
+    INFO("first difference at index " << i);
+    CHECK(i == input_count);
+  }
+}
+
+}  // namespace math_corpus_reference
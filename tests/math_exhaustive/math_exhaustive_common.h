@@ -0,0 +1,386 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Exhaustive accuracy sweep of unary floating point math builtins
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_MATH_EXHAUSTIVE_COMMON_H
+#define __SYCLCTS_TESTS_MATH_EXHAUSTIVE_COMMON_H
+
+#include "../../oclmath/Utility.h"
+#include "../../oclmath/reference_math.h"
+#include "../../util/host_thread_pool.h"
+#include "../../util/math_reference_simd.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace math_exhaustive {
+using namespace sycl_cts;
+
+/**
+ * @brief Number of inputs computed by a single kernel launch. Two chunks are
+ *        in flight at any time: one computed by the device, the other one
+ *        verified by the host.
+ */
+constexpr std::uint64_t chunk_size = std::uint64_t{1} << 24;
+
+/**
+ * @brief Number of inputs each host thread evaluates the reference for at
+ *        once, small enough for the inputs and references to stay in cache
+ */
+constexpr std::size_t reference_block_size = 4096;
+
+template <typename T>
+struct fp_traits;
+
+template <>
+struct fp_traits<float> {
+  using bits_t = std::uint32_t;
+  static constexpr std::uint64_t input_count = std::uint64_t{1} << 32;
+  static constexpr double min_normal = 0x1p-126;
+  static sycl::info::device::single_fp_config::return_type get_fp_config(
+      const sycl::device& device) {
+    return device.get_info<sycl::info::device::single_fp_config>();
+  }
+};
+
+template <>
+struct fp_traits<sycl::half> {
+  using bits_t = std::uint16_t;
+  static constexpr std::uint64_t input_count = std::uint64_t{1} << 16;
+  static constexpr double min_normal = 0x1p-14;
+  static sycl::info::device::half_fp_config::return_type get_fp_config(
+      const sycl::device& device) {
+    return device.get_info<sycl::info::device::half_fp_config>();
+  }
+};
+
+/**
+ * @brief Error of a float result in ulp, following the OpenCL CTS: correctly
+ *        rounded results have no error at all
+ */
+inline float ulp_error(float test, double reference) {
+  if (std::isnan(reference)) {
+    return std::isnan(test) ? 0.0f : std::numeric_limits<float>::infinity();
+  }
+  if (std::isnan(test)) return std::numeric_limits<float>::infinity();
+  if (static_cast<float>(reference) == test) return 0.0f;
+  return std::fabs(Ulp_Error(test, reference));
+}
+
+/**
+ * @brief Error of a half result in ulp of the half precision reference
+ *
+ * oclmath does not provide Ulp_Error_Half, so this mirrors Ulp_Error for an
+ * 11 bit significand, including the tolerance for premature overflow.
+ */
+inline float ulp_error(sycl::half test_half, double reference) {
+  const double test = static_cast<float>(test_half);
+  if (std::isnan(reference)) {
+    return std::isnan(test) ? 0.0f : std::numeric_limits<float>::infinity();
+  }
+  if (std::isnan(test)) return std::numeric_limits<float>::infinity();
+  if (static_cast<float>(static_cast<sycl::half>(
+          static_cast<float>(reference))) == test) {
+    return 0.0f;
+  }
+  if (std::isinf(reference)) {
+    return test == reference ? 0.0f : std::numeric_limits<float>::infinity();
+  }
+  // Pretend infinity is the next power of two after the largest half value
+  const double test_value = std::isinf(test) ? std::copysign(65536.0, test)
+                                             : test;
+  // Exponent of the ulp, limited by the smallest subnormal half value
+  const int exponent =
+      reference == 0.0 ? -24 : std::max(std::ilogb(reference), -14) - 10;
+  return static_cast<float>(
+      std::fabs(std::ldexp(test_value - reference, -exponent)));
+}
+
+/**
+ * @brief Evaluates the scalar oclmath reference of a builtin for an array of
+ *        inputs
+ */
+template <typename BuiltinT>
+void scalar_reference_batch(const float* x, double* results,
+                            std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    results[i] = BuiltinT::reference(x[i]);
+  }
+}
+
+/**
+ * @brief Defines a unary builtin to sweep, together with its oclmath
+ *        reference, the array version of the reference given by `BATCH` and
+ *        its maximum error in ulp for float and half as given by the
+ *        specification
+ */
+#define MATH_EXHAUSTIVE_BUILTIN_WITH_BATCH(NAME, FLOAT_ULP, HALF_ULP, BATCH) \
+  struct NAME##_builtin {                                                    \
+    static constexpr const char* name = #NAME;                               \
+    static constexpr float float_ulp = FLOAT_ULP;                            \
+    static constexpr float half_ulp = HALF_ULP;                              \
+    template <typename T>                                                    \
+    static T apply(T x) {                                                    \
+      return sycl::NAME(x);                                                  \
+    }                                                                        \
+    static double reference(double x) { return reference_##NAME(x); }        \
+    static void reference_batch(const float* x, double* results,             \
+                                std::size_t count) {                         \
+      BATCH(x, results, count);                                              \
+    }                                                                        \
+  };
+
+#define MATH_EXHAUSTIVE_BUILTIN(NAME, FLOAT_ULP, HALF_ULP) \
+  MATH_EXHAUSTIVE_BUILTIN_WITH_BATCH(                      \
+      NAME, FLOAT_ULP, HALF_ULP, scalar_reference_batch<NAME##_builtin>)
+
+/** Builtin whose reference has an array version in math_reference_simd.h */
+#define MATH_EXHAUSTIVE_SIMD_BUILTIN(NAME, FLOAT_ULP, HALF_ULP) \
+  MATH_EXHAUSTIVE_BUILTIN_WITH_BATCH(NAME, FLOAT_ULP, HALF_ULP, \
+                                     math::reference_##NAME##_batch)
+
+MATH_EXHAUSTIVE_BUILTIN(acos, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(acosh, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(acospi, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(asin, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(asinh, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(asinpi, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(atan, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(atanh, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(atanpi, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(cbrt, 2, 2)
+MATH_EXHAUSTIVE_BUILTIN(ceil, 0, 0)
+MATH_EXHAUSTIVE_BUILTIN(cos, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(cosh, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(cospi, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(exp, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(exp2, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(exp10, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(expm1, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(fabs, 0, 0)
+MATH_EXHAUSTIVE_BUILTIN(floor, 0, 0)
+MATH_EXHAUSTIVE_BUILTIN(log, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(log2, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(log10, 3, 2)
+MATH_EXHAUSTIVE_BUILTIN(log1p, 2, 2)
+MATH_EXHAUSTIVE_BUILTIN(logb, 0, 0)
+MATH_EXHAUSTIVE_BUILTIN(rint, 0, 0)
+MATH_EXHAUSTIVE_BUILTIN(round, 0, 0)
+MATH_EXHAUSTIVE_SIMD_BUILTIN(rsqrt, 2, 1)
+MATH_EXHAUSTIVE_BUILTIN(sin, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(sinh, 4, 2)
+MATH_EXHAUSTIVE_BUILTIN(sinpi, 4, 2)
+MATH_EXHAUSTIVE_SIMD_BUILTIN(sqrt, 3, 1.5f)
+MATH_EXHAUSTIVE_BUILTIN(tan, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(tanh, 5, 2)
+MATH_EXHAUSTIVE_BUILTIN(tanpi, 6, 2)
+MATH_EXHAUSTIVE_BUILTIN(trunc, 0, 0)
+
+#undef MATH_EXHAUSTIVE_SIMD_BUILTIN
+#undef MATH_EXHAUSTIVE_BUILTIN
+#undef MATH_EXHAUSTIVE_BUILTIN_WITH_BATCH
+
+template <typename T, typename BuiltinT>
+constexpr float max_ulp =
+    std::is_same_v<T, float> ? BuiltinT::float_ulp : BuiltinT::half_ulp;
+
+template <typename T, typename BuiltinT>
+class sweep_kernel;
+
+/**
+ * @brief Largest error found within a range of inputs
+ */
+struct sweep_result {
+  float max_error = 0;
+  std::uint64_t worst_input = 0;
+  std::uint64_t failures = 0;
+
+  void merge(const sweep_result& other) {
+    if (other.max_error > max_error) {
+      max_error = other.max_error;
+      worst_input = other.worst_input;
+    }
+    failures += other.failures;
+  }
+};
+
+/**
+ * @brief Computes the error of a single device result, given the reference
+ *        for its input. Devices without denormal support may flush subnormal
+ *        inputs and results to zero.
+ */
+template <typename T, typename BuiltinT>
+float get_error(float input, T result, double reference,
+                bool denorm_supported) {
+  const double x = input;
+  float error = ulp_error(result, reference);
+  if (denorm_supported || error == 0.0f) return error;
+
+  constexpr double min_normal = fp_traits<T>::min_normal;
+  if (static_cast<float>(result) == 0.0f && std::fabs(reference) < min_normal) {
+    return 0.0f;
+  }
+  if (x != 0.0 && std::fabs(x) < min_normal) {
+    error = std::min(
+        error, ulp_error(result, BuiltinT::reference(std::copysign(0.0, x))));
+  }
+  return error;
+}
+
+/**
+ * @brief Verifies one chunk of device results on all host threads
+ *
+ * Each thread evaluates the reference in blocks of `reference_block_size`
+ * inputs through the array version of the reference, which is vectorized for
+ * some builtins.
+ */
+template <typename T, typename BuiltinT>
+sweep_result verify_chunk(std::uint64_t first, const T* results,
+                          std::uint64_t count, bool denorm_supported) {
+  using bits_t = typename fp_traits<T>::bits_t;
+  sweep_result total;
+  std::mutex total_mutex;
+  util::get<util::host_thread_pool>().parallel_for(
+      count, [&](std::size_t begin, std::size_t end) {
+        sweep_result local;
+        std::vector<float> inputs(reference_block_size);
+        std::vector<double> references(reference_block_size);
+        for (std::size_t block = begin; block < end;
+             block += reference_block_size) {
+          const std::size_t size =
+              std::min(reference_block_size, end - block);
+          for (std::size_t j = 0; j < size; ++j) {
+            const auto bits = static_cast<bits_t>(first + block + j);
+            inputs[j] = static_cast<float>(sycl::bit_cast<T>(bits));
+          }
+          BuiltinT::reference_batch(inputs.data(), references.data(), size);
+
+          for (std::size_t j = 0; j < size; ++j) {
+            const float error =
+                get_error<T, BuiltinT>(inputs[j], results[block + j],
+                                       references[j], denorm_supported);
+            if (error > max_ulp<T, BuiltinT>) ++local.failures;
+            if (error > local.max_error) {
+              local.max_error = error;
+              local.worst_input = static_cast<bits_t>(first + block + j);
+            }
+          }
+        }
+        std::lock_guard<std::mutex> lock(total_mutex);
+        total.merge(local);
+      });
+  return total;
+}
+
+/**
+ * @brief Runs the builtin for every representable input on the device and
+ *        compares each result against the oclmath reference
+ *
+ * Chunks are computed alternately into two buffers. While the device computes
+ * chunk i + 1, the host verifies chunk i.
+ */
+template <typename T, typename BuiltinT>
+void sweep(const std::string& type_name) {
+  using bits_t = typename fp_traits<T>::bits_t;
+  constexpr std::uint64_t input_count = fp_traits<T>::input_count;
+  constexpr std::uint64_t size = std::min(chunk_size, input_count);
+  constexpr std::uint64_t chunk_count = input_count / size;
+
+  auto& queue = once_per_unit::get_queue();
+  const auto fp_config = fp_traits<T>::get_fp_config(queue.get_device());
+  const bool denorm_supported =
+      std::find(fp_config.begin(), fp_config.end(),
+                sycl::info::fp_config::denorm) != fp_config.end();
+
+  sycl::buffer<T, 1> buffers[] = {sycl::buffer<T, 1>{sycl::range<1>(size)},
+                                  sycl::buffer<T, 1>{sycl::range<1>(size)}};
+  auto submit = [&](std::uint64_t chunk) {
+    util::submit_and_record(queue, [&](sycl::handler& cgh) {
+      sycl::accessor out{buffers[chunk % 2], cgh, sycl::write_only,
+                         sycl::no_init};
+      const std::uint64_t first = chunk * size;
+      cgh.parallel_for<sweep_kernel<T, BuiltinT>>(
+          sycl::range<1>(size), [=](sycl::id<1> id) {
+            const auto bits = static_cast<bits_t>(first + id[0]);
+            out[id] = BuiltinT::apply(sycl::bit_cast<T>(bits));
+          });
+    });
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  sweep_result result;
+  submit(0);
+  for (std::uint64_t chunk = 0; chunk < chunk_count; ++chunk) {
+    if (chunk + 1 < chunk_count) submit(chunk + 1);
+    sycl::host_accessor results{buffers[chunk % 2], sycl::read_only};
+    result.merge(verify_chunk<T, BuiltinT>(chunk * size, &results[0], size,
+                                           denorm_supported));
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::ostringstream worst_input;
+  worst_input << std::hex << std::setfill('0')
+              << std::setw(sizeof(bits_t) * 2) << result.worst_input;
+  WARN("sycl::" << BuiltinT::name << "(" << type_name << "): max error "
+                << result.max_error << " ulp at input 0x" << worst_input.str()
+                << " (allowed " << max_ulp<T, BuiltinT> << " ulp), "
+                << result.failures << " of " << input_count
+                << " inputs exceed the allowed error, " << elapsed.count()
+                << " s");
+  CHECK(result.failures == 0);
+}
+
+/**
+ * @brief Sweeps all given builtins, each one in its own section
+ */
+template <typename T, typename... BuiltinsT>
+void sweep_all(const std::string& type_name) {
+  ((
+       [&] {
+         SECTION(std::string("sycl::") + BuiltinsT::name) {
+           sweep<T, BuiltinsT>(type_name);
+         }
+       }()),
+   ...);
+}
+
+/**
+ * @brief Sweeps every builtin defined in this header
+ */
+template <typename T>
+void sweep_all_builtins(const std::string& type_name) {
+  sweep_all<T, acos_builtin, acosh_builtin, acospi_builtin, asin_builtin,
+            asinh_builtin, asinpi_builtin, atan_builtin, atanh_builtin,
+            atanpi_builtin, cbrt_builtin, ceil_builtin, cos_builtin,
+            cosh_builtin, cospi_builtin, exp_builtin, exp2_builtin,
+            exp10_builtin, expm1_builtin, fabs_builtin, floor_builtin,
+            log_builtin, log2_builtin, log10_builtin, log1p_builtin,
+            logb_builtin, rint_builtin, round_builtin, rsqrt_builtin,
+            sin_builtin, sinh_builtin, sinpi_builtin, sqrt_builtin,
+            tan_builtin, tanh_builtin, tanpi_builtin, trunc_builtin>(
+      type_name);
+}
+
+}  // namespace math_exhaustive
+
+#endif  // __SYCLCTS_TESTS_MATH_EXHAUSTIVE_COMMON_H
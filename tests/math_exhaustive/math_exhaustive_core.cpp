@@ -0,0 +1,21 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "math_exhaustive_common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace math_exhaustive_core {
+
+TEST_CASE("Exhaustive accuracy of unary math builtins. float",
+          "[math_exhaustive]") {
+  math_exhaustive::sweep_all_builtins<float>("float");
+}
+
+}  // namespace math_exhaustive_core
@@ -0,0 +1,25 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "math_exhaustive_common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace math_exhaustive_fp16 {
+
+TEST_CASE("Exhaustive accuracy of unary math builtins. sycl::half",
+          "[math_exhaustive]") {
+  auto& queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations");
+  }
+  math_exhaustive::sweep_all_builtins<sycl::half>("sycl::half");
+}
+
+}  // namespace math_exhaustive_fp16
@@ -0,0 +1,240 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides tests for the thread safety and throughput scaling of concurrent
+//  submissions to multiple queues from multiple host threads
+//
+*******************************************************************************/
+
+#include "../../util/stress_config.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace queue_concurrency {
+using namespace sycl_cts;
+
+class increment_kernel;
+
+/** Numbers of host threads the scaling is measured for */
+constexpr std::size_t thread_counts[] = {1, 2, 4, 8};
+
+/** Number of elements of the buffer each thread updates */
+constexpr std::size_t elements_per_thread = 1024;
+
+/** Number of kernels submitted before waiting for their completion */
+constexpr std::size_t batch_size = 100;
+
+/**
+ * Time each thread keeps submitting for if `--stress-duration` is not set.
+ * A single batch would mostly measure the setup of threads and buffers.
+ */
+constexpr std::chrono::milliseconds default_duration{250};
+
+/** Outcome of a single host thread */
+struct thread_result {
+  std::size_t submissions = 0;
+  std::size_t mismatches = 0;
+  std::exception_ptr exception;
+};
+
+/** Outcome of all host threads of a run */
+struct run_result {
+  std::size_t submissions = 0;
+  std::size_t mismatches = 0;
+  double seconds = 0;
+
+  double throughput() const { return seconds > 0 ? submissions / seconds : 0; }
+};
+
+/**
+ * @brief Submits batches of kernels to the given queue until the stress
+ *        duration, or `default_duration` if it is not set, has elapsed, and
+ *        checks the result
+ *
+ * Every kernel adds `value` to each element of a buffer private to the thread
+ * and increments `counters[slot]`. All kernels of a thread depend on each
+ * other through the private buffer, so the buffer holds the exact number of
+ * kernels executed if all dependencies have been honored.
+ */
+void drive_queue(sycl::queue queue, int value, sycl::buffer<int> counters,
+                 std::size_t slot, thread_result& result) {
+  const std::vector<int> zeros(elements_per_thread, 0);
+  sycl::buffer<int> data{zeros.begin(), zeros.end()};
+  auto duration = util::get<util::stress_config>().get_duration();
+  if (duration.count() == 0) duration = default_duration;
+  const auto start = std::chrono::steady_clock::now();
+  do {
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{data, cgh, sycl::read_write};
+        sycl::accessor counter{counters, cgh, sycl::read_write};
+        cgh.parallel_for<increment_kernel>(
+            sycl::range<1>{elements_per_thread}, [=](sycl::id<1> id) {
+              acc[id] += value;
+              if (id[0] == 0) counter[slot] += 1;
+            });
+      });
+    }
+    result.submissions += batch_size;
+    queue.wait_and_throw();
+  } while (std::chrono::steady_clock::now() - start < duration);
+
+  const int expected = value * static_cast<int>(result.submissions);
+  sycl::host_accessor acc{data, sycl::read_only};
+  for (std::size_t i = 0; i < elements_per_thread; ++i) {
+    if (acc[i] != expected) ++result.mismatches;
+  }
+}
+
+/**
+ * @brief Drives each of the given queues from its own host thread
+ * @param shared_counters Whether all threads increment counters of a single
+ *        buffer, which orders the kernels of all threads with respect to each
+ *        other, instead of a buffer private to each thread
+ */
+run_result run_threads(const std::vector<sycl::queue>& queues,
+                       bool shared_counters) {
+  const std::size_t thread_count = queues.size();
+  const std::vector<int> zeros(thread_count, 0);
+  std::vector<sycl::buffer<int>> counters;
+  for (std::size_t t = 0; t < (shared_counters ? 1 : thread_count); ++t) {
+    counters.emplace_back(zeros.begin(), zeros.end());
+  }
+
+  std::vector<thread_result> results(thread_count);
+  std::vector<std::thread> threads;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&, t] {
+      try {
+        drive_queue(queues[t], static_cast<int>(t + 1),
+                    counters[shared_counters ? 0 : t], t, results[t]);
+      } catch (...) {
+        results[t].exception = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  run_result run;
+  run.seconds = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    if (results[t].exception) std::rethrow_exception(results[t].exception);
+    auto& buffer = counters[shared_counters ? 0 : t];
+    sycl::host_accessor counter{buffer, sycl::read_only};
+    if (counter[t] != static_cast<int>(results[t].submissions)) {
+      ++run.mismatches;
+    }
+    run.submissions += results[t].submissions;
+    run.mismatches += results[t].mismatches;
+  }
+  return run;
+}
+
+/**
+ * @brief Reports the aggregate throughput of a run and its speedup over the
+ *        given baseline throughput
+ */
+void report(const std::string& description, const run_result& run,
+            double baseline) {
+  WARN(description << ": " << std::scientific << std::setprecision(3)
+                   << run.throughput() << " submissions/s, "
+                   << std::defaultfloat
+                   << (baseline > 0 ? run.throughput() / baseline : 0)
+                   << "x the baseline (" << run.submissions
+                   << " submissions)");
+}
+
+/**
+ * @brief Measures the scaling of the number of host threads, each driving a
+ *        queue created by `make_queue`
+ */
+template <typename MakeQueueT>
+void check_thread_scaling(const std::string& description, bool shared_counters,
+                          MakeQueueT make_queue) {
+  double baseline = 0;
+  for (const std::size_t thread_count : thread_counts) {
+    std::vector<sycl::queue> queues;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+      queues.push_back(make_queue());
+    }
+    const auto run = run_threads(queues, shared_counters);
+    if (thread_count == 1) baseline = run.throughput();
+    report(std::to_string(thread_count) + " threads, " + description, run,
+           baseline);
+    CHECK(run.mismatches == 0);
+  }
+}
+
+TEST_CASE("concurrent submission to one queue per thread",
+          "[queue_concurrency]") {
+  auto& queue = once_per_unit::get_queue();
+  check_thread_scaling("one queue per thread", false, [&] {
+    return sycl::queue{queue.get_context(), queue.get_device(),
+                       cts_async_handler{}};
+  });
+}
+
+TEST_CASE("concurrent submission to a queue shared by all threads",
+          "[queue_concurrency]") {
+  auto& queue = once_per_unit::get_queue();
+  check_thread_scaling("shared queue", false, [&] { return queue; });
+}
+
+TEST_CASE("concurrent submission with dependencies across queues",
+          "[queue_concurrency]") {
+  // All kernels access the same counter buffer, so the runtime has to track
+  // dependencies between commands submitted concurrently to different queues
+  auto& queue = once_per_unit::get_queue();
+  check_thread_scaling("one queue per thread, shared buffer", true, [&] {
+    return sycl::queue{queue.get_context(), queue.get_device(),
+                       cts_async_handler{}};
+  });
+}
+
+TEST_CASE("concurrent submission to queues of all selected devices",
+          "[queue_concurrency]") {
+  // All devices accepted by the CTS selector, which are the devices matching
+  // the --device regex if it has been set
+  std::vector<sycl::device> devices;
+  for (const auto& device : sycl::device::get_devices()) {
+    if (cts_selector(device) >= 0) devices.push_back(device);
+  }
+  if (devices.size() < 2) {
+    SKIP("Less than two devices are selected");
+  }
+
+  std::vector<sycl::queue> queues;
+  double sum_of_single = 0;
+  for (const auto& device : devices) {
+    queues.emplace_back(device, cts_async_handler{});
+    const auto run = run_threads({queues.back()}, false);
+    sum_of_single += run.throughput();
+    report("single thread on " + device.get_info<sycl::info::device::name>(),
+           run, run.throughput());
+    CHECK(run.mismatches == 0);
+  }
+
+  const auto run = run_threads(queues, false);
+  report(std::to_string(devices.size()) +
+             " threads, one queue per device, relative to the sum of the "
+             "single device throughputs",
+         run, sum_of_single);
+  CHECK(run.mismatches == 0);
+}
+
+}  // namespace queue_concurrency
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+
+"""
+Summarizes the build times recorded by measure_build_time.py.
+Invoked by the 'cts_build_report' target, which is available if
+SYCL_CTS_MEASURE_BUILD_TIMES=ON is specified during CMake configuration.
+
+Compile times are aggregated per test category, per generator (for sources
+generated from a template or by a generator script) and per type pack (the
+type or variant a generated source has been instantiated for). If the sources
+have been compiled with '-ftime-trace' (SYCL_CTS_BUILD_TIME_TRACE=ON), the
+most expensive template instantiations across all translation units are listed
+as well.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+from collections import defaultdict
+from pathlib import Path
+
+SOURCE_ROOT = Path(__file__).resolve().parent.parent
+
+LOG_LINE_REGEX = re.compile(r'^(\S+) (\S+) \((.*)\)((?: \w+=\S+)*)$')
+
+# Suffixes of hand-written sources that split a category by feature set
+TYPE_PACK_SUFFIXES = ['core', 'fp16', 'fp64', 'atomic64']
+
+# Trace events that correspond to template instantiations
+INSTANTIATION_EVENTS = ['InstantiateClass', 'InstantiateFunction']
+
+
+def handle_args(argv):
+    parser = argparse.ArgumentParser(
+        description='Summarizes the build times of the CTS')
+    parser.add_argument('build_dir',
+                        help='CMake build directory containing build_times.log')
+    parser.add_argument('--top',
+                        help='Number of entries listed in each ranking',
+                        type=int,
+                        default=20)
+    parser.add_argument('--output',
+                        help='Write the aggregated results as JSON to the '
+                        'given file',
+                        type=str)
+    return parser.parse_args(argv)
+
+
+def read_build_times(build_dir):
+    """
+    Reads all entries of build_times.log. Later entries for the same object
+    file, e.g. from incremental rebuilds, replace earlier ones.
+    """
+    entries = {}
+    with open(build_dir / 'build_times.log') as log_file:
+        for line in log_file:
+            match = LOG_LINE_REGEX.match(line.strip())
+            if not match:
+                continue
+            fields = dict(
+                field.split('=', 1) for field in match.group(4).split())
+            source = (build_dir / match.group(3)).resolve()
+            entries[(match.group(2), str(source))] = {
+                'time': float(match.group(1)),
+                'source': source,
+                'rss': int(fields['rss']) if 'rss' in fields else None,
+                'trace': build_dir / fields['trace']
+                if 'trace' in fields else None,
+            }
+    return list(entries.values())
+
+
+def is_relative_to(path, base):
+    try:
+        path.relative_to(base)
+        return True
+    except ValueError:
+        return False
+
+
+def strip_common_prefix(name, prefix):
+    """
+    Removes the longest common prefix of both names that ends with an
+    underscore, e.g. 'math_builtin_float_base' for 'math_builtin_api' yields
+    'float_base'.
+    """
+    length = 0
+    for i, (a, b) in enumerate(zip(name, prefix)):
+        if a != b:
+            break
+        if a == '_':
+            length = i + 1
+    if name.startswith(prefix + '_'):
+        length = len(prefix) + 1
+    return name[length:]
+
+
+def classify(source, build_dir):
+    """
+    Returns the category, the generator and the type pack of a source file.
+    Generator and type pack are None for hand-written sources that are not
+    split by type.
+    """
+    generated = is_relative_to(source, build_dir)
+    root = build_dir if generated else SOURCE_ROOT
+    try:
+        parts = source.relative_to(root).parts
+    except ValueError:
+        return (source.parent.name, None, None)
+
+    if len(parts) > 2 and parts[0] == 'tests':
+        category = parts[1]
+    else:
+        category = parts[0]
+    stem = source.stem
+
+    if not generated:
+        suffix = stem.rsplit('_', 1)[-1]
+        return (category, None,
+                suffix if suffix in TYPE_PACK_SUFFIXES else None)
+
+    # Unity build sources combine several generated sources
+    if 'unity' in parts[:-1]:
+        return (category, None, None)
+
+    category_dir = SOURCE_ROOT / 'tests' / category
+    # Sources configured from a '<name>.cpp.in' template per type
+    templates = sorted(category_dir.glob('*.cpp.in'),
+                       key=lambda t: len(t.name),
+                       reverse=True)
+    for template in templates:
+        template_name = template.name[:-len('.cpp.in')]
+        if stem.startswith(template_name + '_'):
+            return (category, template.name, stem[len(template_name) + 1:])
+
+    # Sources emitted by a generator script, possibly split into fragments
+    generators = sorted(category_dir.glob('generate_*.py'))
+    if generators:
+        type_pack = re.sub(r'_[0-9]+$', '', stem)
+        return (category, generators[0].name,
+                strip_common_prefix(type_pack, category))
+
+    return (category, None, None)
+
+
+def read_instantiations(trace_file):
+    """
+    Returns the total time in seconds spent on each template instantiation
+    within a single '-ftime-trace' file.
+    """
+    result = defaultdict(float)
+    try:
+        with open(trace_file) as trace:
+            events = json.load(trace).get('traceEvents', [])
+    except (OSError, ValueError):
+        return result
+    for event in events:
+        if event.get('name') not in INSTANTIATION_EVENTS:
+            continue
+        detail = event.get('args', {}).get('detail', '')
+        result[(event['name'], detail)] += event.get('dur', 0) * 1e-6
+    return result
+
+
+def aggregate(entries, key):
+    groups = defaultdict(lambda: {'time': 0.0, 'count': 0, 'max-rss': None})
+    for entry in entries:
+        name = entry[key]
+        if name is None:
+            continue
+        group = groups[name]
+        group['time'] += entry['time']
+        group['count'] += 1
+        if entry['rss'] is not None:
+            group['max-rss'] = max(group['max-rss'] or 0, entry['rss'])
+    return sorted(([name, values] for name, values in groups.items()),
+                  key=lambda item: item[1]['time'],
+                  reverse=True)
+
+
+def format_rss(rss_kib):
+    return '-' if rss_kib is None else f'{rss_kib / 1024:.0f} MiB'
+
+
+def print_table(title, rows, total_time, top):
+    print(f'\n{title}')
+    print(f'{"time [s]":>10} {"share":>7} {"TUs":>5} {"peak RSS":>10}  name')
+    for name, values in rows[:top]:
+        share = values['time'] / total_time * 100 if total_time > 0 else 0
+        print(f'{values["time"]:10.1f} {share:6.1f}% {values["count"]:5d} '
+              f'{format_rss(values["max-rss"]):>10}  {name}')
+    if len(rows) > top:
+        print(f'... {len(rows) - top} more')
+
+
+def main(argv=sys.argv[1:]):
+    args = handle_args(argv)
+    build_dir = Path(args.build_dir).resolve()
+    if not (build_dir / 'build_times.log').is_file():
+        print(f'No build times recorded in {build_dir}. Configure with '
+              '-DSYCL_CTS_MEASURE_BUILD_TIMES=ON and build the CTS first.')
+        return 1
+
+    entries = read_build_times(build_dir)
+    for entry in entries:
+        (entry['category'], entry['generator'],
+         entry['type-pack']) = classify(entry['source'], build_dir)
+        entry['tu'] = os.path.relpath(entry['source'], build_dir)
+
+    total_time = sum(entry['time'] for entry in entries)
+    print(f'Total compile time: {total_time:.1f} s in {len(entries)} '
+          'translation units')
+
+    report = {
+        'total-time': total_time,
+        'translation-units': len(entries),
+        'categories': aggregate(entries, 'category'),
+        'generators': aggregate(entries, 'generator'),
+        'type-packs': aggregate(entries, 'type-pack'),
+        'slowest-translation-units': aggregate(entries, 'tu'),
+    }
+    print_table('Compile time per category:', report['categories'],
+                total_time, args.top)
+    print_table('Compile time per generator:', report['generators'],
+                total_time, args.top)
+    print_table('Compile time per type pack:', report['type-packs'],
+                total_time, args.top)
+    print_table('Slowest translation units:',
+                report['slowest-translation-units'], total_time, args.top)
+
+    instantiations = defaultdict(float)
+    for entry in entries:
+        if entry['trace'] is None:
+            continue
+        for name, time in read_instantiations(entry['trace']).items():
+            instantiations[name] += time
+    if instantiations:
+        hot_spots = sorted(instantiations.items(),
+                           key=lambda item: item[1],
+                           reverse=True)[:args.top]
+        report['instantiation-hot-spots'] = [{
+            'kind': kind,
+            'detail': detail,
+            'time': time
+        } for (kind, detail), time in hot_spots]
+        print('\nTemplate instantiation hot spots:')
+        print(f'{"time [s]":>10}  name')
+        for (kind, detail), time in hot_spots:
+            print(f'{time:10.1f}  {kind} {detail}')
+
+    if args.output:
+        with open(args.output, 'w') as output_file:
+            json.dump(report, output_file, indent=2)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
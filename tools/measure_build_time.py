@@ -1,23 +1,33 @@
 #!/usr/bin/env python3
 
 """
-Utility script for measuring the build time of a translation unit.
+Utility script for measuring the build time and peak memory usage of a
+translation unit.
 Not intended for manual use.
 To enable, specify SYCL_CTS_MEASURE_BUILD_TIMES=ON during CMake configuration.
+The results can be summarized using the 'cts_build_report' target.
 """
 
 import os
 import subprocess
 import sys
+import time
 
 from pathlib import Path
 from timeit import default_timer as timer
 
+try:
+    import resource
+except ImportError:
+    # Not available on Windows
+    resource = None
+
 args = sys.argv[1:]
 
 # We assume arguments to end with '-o <object file> -c <source file>'
 # FIXME: This may not work with MSVC
-obj_file = os.path.basename(args[-3])
+obj_path = args[-3]
+obj_file = os.path.basename(obj_path)
 src_file = args[-1]
 
 # Locate build root: The compiler may not always be launched directly from
@@ -33,11 +43,31 @@ for p in [build_root] + list(build_root.parents):
 # Make source file path relative to build directory
 src_file = os.path.relpath(src_file, build_root)
 
+start_time = time.time()
 ts_before = timer()
-subprocess.run(' '.join(args), shell=True)
+result = subprocess.run(' '.join(args), shell=True)
 ts_after = timer()
 dt = ts_after - ts_before
 
+extra_fields = ""
+if resource is not None:
+    # Peak resident set size of the compiler process in KiB. As this script
+    # only runs a single compiler invocation, the maximum over all children
+    # corresponds to that invocation.
+    rss_kib = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    if sys.platform == "darwin":
+        rss_kib //= 1024
+    extra_fields += f" rss={rss_kib}"
+
+# Clang writes the '-ftime-trace' output next to the object file. Ignore
+# traces left over from previous builds.
+trace_file = os.path.join(os.getcwd(),
+                          os.path.splitext(obj_path)[0] + ".json")
+if os.path.isfile(trace_file) and os.path.getmtime(trace_file) >= start_time:
+    extra_fields += f" trace={os.path.relpath(trace_file, build_root)}"
+
 with open(build_root / "build_times.log", "a") as output_file:
-    print(f"{dt:.1f} {obj_file} ({src_file})",
+    print(f"{dt:.1f} {obj_file} ({src_file}){extra_fields}",
           file=output_file)
+
+sys.exit(result.returncode)
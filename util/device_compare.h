@@ -0,0 +1,144 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Verification of buffer contents on the device, transferring only a summary
+//  of the mismatches to the host
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_DEVICE_COMPARE_H
+#define __SYCLCTS_UTIL_DEVICE_COMPARE_H
+
+#include "timing_report.h"
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/** Default number of mismatches whose indices are reported */
+constexpr std::size_t default_reported_mismatches = 8;
+
+/**
+ * @brief Summary of the comparison of a buffer on the device
+ */
+template <typename T>
+struct device_compare_result {
+  /** Total number of mismatching elements */
+  std::size_t mismatch_count = 0;
+  /** Linear indices of the first mismatching elements, in ascending order */
+  std::vector<std::size_t> first_mismatches;
+  /** Values of the elements at first_mismatches */
+  std::vector<T> first_mismatch_values;
+
+  bool passed() const { return mismatch_count == 0; }
+};
+
+template <typename T, int Dims, typename PredicateT>
+class device_compare_kernel;
+
+namespace detail {
+
+template <int Dims>
+sycl::id<Dims> linear_to_id(const sycl::range<Dims>& range,
+                            std::size_t linear) {
+  sycl::id<Dims> id;
+  for (int d = Dims - 1; d >= 0; --d) {
+    id[d] = linear % range[d];
+    linear /= range[d];
+  }
+  return id;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Checks every element of a buffer on the device and transfers only the
+ *        number of mismatches and the first mismatching elements to the host
+ *
+ * Mismatches are counted using an atomic counter, and the first
+ * `max_reported` mismatches found by any work-item are recorded. Only if there
+ * are more mismatches than that, the buffer is read back to determine the
+ * mismatches with the lowest indices, so passing checks never read back the
+ * buffer.
+ *
+ * @param predicate Device copyable callable with the signature
+ *        `bool(sycl::id<Dims>, const T&)`, returning whether the value at the
+ *        given index is as expected. Used as part of the kernel name, so it has
+ *        to be a forward-declarable type rather than a lambda. It is also
+ *        called on the host to find the first mismatches.
+ * @param max_reported Maximum number of mismatches reported
+ */
+template <typename T, int Dims, typename PredicateT>
+device_compare_result<T> compare_on_device(
+    sycl::queue& queue, sycl::buffer<T, Dims>& buffer, PredicateT predicate,
+    std::size_t max_reported = default_reported_mismatches) {
+  using counter_t = unsigned int;
+  assert(buffer.size() <= std::numeric_limits<counter_t>::max() &&
+         "Mismatches are counted with 32-bit atomics");
+
+  device_compare_result<T> result;
+  const std::size_t slot_count = std::max<std::size_t>(max_reported, 1);
+  sycl::buffer<counter_t> count_buf{sycl::range<1>{1}};
+  sycl::buffer<std::size_t> slot_buf{sycl::range<1>{slot_count}};
+
+  submit_and_record(queue, [&](sycl::handler& cgh) {
+    sycl::accessor count{count_buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.fill(count, counter_t{0});
+  });
+  submit_and_record(queue, [&](sycl::handler& cgh) {
+    sycl::accessor values{buffer, cgh, sycl::read_only};
+    sycl::accessor count{count_buf, cgh, sycl::read_write};
+    sycl::accessor slots{slot_buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.parallel_for<device_compare_kernel<T, Dims, PredicateT>>(
+        buffer.get_range(), [=](sycl::item<Dims> item) {
+          if (predicate(item.get_id(), values[item.get_id()])) return;
+          sycl::atomic_ref<counter_t, sycl::memory_order::relaxed,
+                           sycl::memory_scope::device,
+                           sycl::access::address_space::global_space>
+              counter{count[0]};
+          const counter_t slot = counter.fetch_add(1);
+          if (slot < slot_count) slots[slot] = item.get_linear_id();
+        });
+  });
+
+  result.mismatch_count = sycl::host_accessor{count_buf, sycl::read_only}[0];
+  if (result.passed()) return result;
+
+  const auto range = buffer.get_range();
+  sycl::host_accessor values{buffer, sycl::read_only};
+  if (result.mismatch_count <= max_reported) {
+    // All mismatches have been recorded
+    sycl::host_accessor slots{slot_buf, sycl::read_only};
+    result.first_mismatches.assign(slots.begin(),
+                                   slots.begin() + result.mismatch_count);
+    std::sort(result.first_mismatches.begin(), result.first_mismatches.end());
+  } else {
+    for (std::size_t i = 0;
+         i < range.size() && result.first_mismatches.size() < max_reported;
+         ++i) {
+      const auto id = detail::linear_to_id(range, i);
+      if (!predicate(id, values[id])) result.first_mismatches.push_back(i);
+    }
+  }
+  for (const auto index : result.first_mismatches) {
+    result.first_mismatch_values.push_back(
+        values[detail::linear_to_id(range, index)]);
+  }
+  return result;
+}
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_DEVICE_COMPARE_H
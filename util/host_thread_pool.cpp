@@ -0,0 +1,83 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "host_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfenv>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+// Number of chunks per thread, allowing threads that process cheap elements to
+// pick up the remaining work of others
+static constexpr std::size_t chunks_per_thread = 8;
+
+std::size_t host_thread_pool::get_thread_count() const {
+  if (thread_count > 0) return thread_count;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void host_thread_pool::run(
+    std::size_t count,
+    const std::function<void(std::size_t, std::size_t)>& func) {
+  if (count == 0) return;
+  const std::size_t threads = std::min(get_thread_count(), count);
+  if (threads == 1) {
+    func(0, count);
+    return;
+  }
+
+  const std::size_t chunk_size =
+      std::max<std::size_t>(1, count / (threads * chunks_per_thread));
+  std::atomic<std::size_t> next_chunk{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  // Results of the reference functions depend on the rounding mode and the
+  // denormal handling, so all threads have to match the calling thread
+  std::fenv_t environment;
+  std::fegetenv(&environment);
+
+  auto worker = [&]() {
+    std::fesetenv(&environment);
+    try {
+      for (;;) {
+        const std::size_t begin = next_chunk.fetch_add(chunk_size);
+        if (begin >= count) break;
+        func(begin, std::min(begin + chunk_size, count));
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+      // Stop the other threads from picking up new chunks
+      next_chunk = count;
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (std::size_t i = 1; i < threads; ++i) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : pool) {
+    thread.join();
+  }
+
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace util
+}  // namespace sycl_cts
@@ -0,0 +1,63 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Parallel execution of host-side verification work
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_HOST_THREAD_POOL_H
+#define __SYCLCTS_UTIL_HOST_THREAD_POOL_H
+
+#include "singleton.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Distributes host-side work, like the evaluation of reference results, over
+ * multiple threads. The number of threads defaults to the number of host
+ * cores and can be set using the `--host-threads` CLI parameter.
+ */
+class host_thread_pool : public singleton<host_thread_pool> {
+ public:
+  /**
+   * Sets the number of threads used by parallel_for(). A value of 0 selects
+   * the number of host cores.
+   */
+  void set_thread_count(std::size_t count) { thread_count = count; }
+
+  std::size_t get_thread_count() const;
+
+  /**
+   * Calls `func(begin, end)` for consecutive chunks of the range
+   * [0, count) and blocks until all chunks have been processed. Chunks are
+   * processed concurrently, so `func` must only write to data owned by the
+   * given chunk. Each thread uses the floating-point environment (rounding
+   * mode, denormal handling) of the calling thread. The first exception thrown
+   * by `func` is rethrown once all threads have finished.
+   */
+  template <typename Func>
+  void parallel_for(std::size_t count, Func&& func) {
+    run(count, std::function<void(std::size_t, std::size_t)>(
+                   std::forward<Func>(func)));
+  }
+
+ private:
+  void run(std::size_t count,
+           const std::function<void(std::size_t, std::size_t)>& func);
+
+  std::size_t thread_count = 0;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_HOST_THREAD_POOL_H
@@ -0,0 +1,127 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "input_corpus.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SYCL_CTS_INPUT_CORPUS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SYCL_CTS_INPUT_CORPUS_MMAP 0
+#endif
+
+#ifndef SYCL_CTS_INPUT_CORPUS_DIR
+#define SYCL_CTS_INPUT_CORPUS_DIR "input_corpus"
+#endif
+
+namespace sycl_cts {
+namespace util {
+
+static constexpr char corpus_magic[8] = {'S', 'Y', 'C', 'L',
+                                         'C', 'O', 'R', 'P'};
+static constexpr std::uint32_t corpus_version = 1;
+
+template <typename T>
+static T read_little_endian(const unsigned char* bytes) {
+  T value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<T>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
+static bool host_is_little_endian() {
+  const std::uint32_t value = 1;
+  unsigned char first;
+  std::memcpy(&first, &value, 1);
+  return first == 1;
+}
+
+std::string input_corpus_config::get_directory() const {
+  return directory.empty() ? SYCL_CTS_INPUT_CORPUS_DIR : directory;
+}
+
+input_corpus::input_corpus(const std::string& path) : path(path) {
+#if SYCL_CTS_INPUT_CORPUS_MMAP
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      void* address = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                             PROT_READ, MAP_PRIVATE, fd, 0);
+      if (address != MAP_FAILED) {
+        data = static_cast<const unsigned char*>(address);
+        length = static_cast<std::size_t>(info.st_size);
+        mapped = true;
+      }
+    }
+    ::close(fd);
+  }
+#endif
+  if (!mapped) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("Cannot open input corpus " + path);
+    }
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+    data = contents.data();
+    length = contents.size();
+  }
+
+  if (length < header_size ||
+      std::memcmp(data, corpus_magic, sizeof(corpus_magic)) != 0 ||
+      read_little_endian<std::uint32_t>(data + 8) != corpus_version) {
+    throw std::runtime_error("Invalid input corpus " + path);
+  }
+  // Elements are used in place, so they have to be in host byte order
+  if (!host_is_little_endian()) {
+    throw std::runtime_error("Input corpora require a little-endian host");
+  }
+  element_size = read_little_endian<std::uint32_t>(data + 12);
+  arity = read_little_endian<std::uint32_t>(data + 16);
+  count =
+      static_cast<std::size_t>(read_little_endian<std::uint64_t>(data + 24));
+  if (length != header_size + arity * count * element_size) {
+    throw std::runtime_error("Truncated input corpus " + path);
+  }
+}
+
+input_corpus::input_corpus(input_corpus&& other) noexcept
+    : path(std::move(other.path)),
+      data(other.data),
+      length(other.length),
+      mapped(other.mapped),
+      contents(std::move(other.contents)),
+      element_size(other.element_size),
+      arity(other.arity),
+      count(other.count) {
+  if (!mapped) data = contents.data();
+  other.data = nullptr;
+  other.mapped = false;
+}
+
+input_corpus::~input_corpus() {
+#if SYCL_CTS_INPUT_CORPUS_MMAP
+  if (mapped) {
+    ::munmap(const_cast<unsigned char*>(data), length);
+  }
+#endif
+}
+
+}  // namespace util
+}  // namespace sycl_cts
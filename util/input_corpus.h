@@ -0,0 +1,104 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Memory-mapped binary input corpora generated at build time
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_INPUT_CORPUS_H
+#define __SYCLCTS_UTIL_INPUT_CORPUS_H
+
+#include "singleton.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Location of the corpus files, set using the `--input-corpus-dir` CLI
+ * parameter. Defaults to the directory the build writes them to.
+ */
+class input_corpus_config : public singleton<input_corpus_config> {
+ public:
+  std::string get_directory() const;
+  void set_directory(const std::string& path) { directory = path; }
+
+ private:
+  std::string directory;
+};
+
+/**
+ * @brief Read-only view of a binary input corpus
+ *
+ * Corpus files are written by tests/common/common_python_corpus.py. They start
+ * with a 32 byte little-endian header:
+ *   - the magic bytes "SYCLCORP"
+ *   - uint32_t version, currently 1
+ *   - uint32_t size of each element in bytes
+ *   - uint32_t number of arguments
+ *   - uint32_t reserved, 0
+ *   - uint64_t number of inputs
+ *
+ * The header is followed by one array of elements per argument, so element i
+ * of every array forms input i. The file is memory-mapped where supported, so
+ * opening even large corpora is cheap and only the pages that are read are
+ * loaded.
+ */
+class input_corpus {
+ public:
+  /** Opens the given file, throws std::runtime_error if it is not valid */
+  explicit input_corpus(const std::string& path);
+
+  /** Opens `<name>.bin` in the directory given by input_corpus_config */
+  static input_corpus open(const std::string& name) {
+    return input_corpus{get<input_corpus_config>().get_directory() + "/" +
+                        name + ".bin"};
+  }
+
+  input_corpus(input_corpus&& other) noexcept;
+  input_corpus(const input_corpus&) = delete;
+  input_corpus& operator=(const input_corpus&) = delete;
+  input_corpus& operator=(input_corpus&&) = delete;
+  ~input_corpus();
+
+  /** Number of inputs */
+  std::size_t size() const { return count; }
+
+  std::size_t get_arity() const { return arity; }
+
+  /** Values of the given argument for all inputs */
+  template <typename T>
+  const T* get_argument(std::size_t index) const {
+    if (sizeof(T) != element_size || index >= arity) {
+      throw std::runtime_error("Invalid argument type or index for " + path);
+    }
+    return reinterpret_cast<const T*>(data + header_size +
+                                      index * count * element_size);
+  }
+
+ private:
+  static constexpr std::size_t header_size = 32;
+
+  std::string path;
+  const unsigned char* data = nullptr;
+  std::size_t length = 0;
+  bool mapped = false;
+  std::vector<unsigned char> contents;
+  std::size_t element_size = 0;
+  std::size_t arity = 0;
+  std::size_t count = 0;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_INPUT_CORPUS_H
@@ -11,8 +11,10 @@
 #ifndef __SYCLCTS_UTIL_MATH_HELPER_H
 #define __SYCLCTS_UTIL_MATH_HELPER_H
 
-#include <map>
+#include <bitset>
 #include <climits>
+#include <cstddef>
+#include <type_traits>
 
 #include <sycl/sycl.hpp>
 
@@ -23,23 +25,41 @@ namespace sycl_cts {
 /** math utility functions
  */
 
+/** Number of elements of a scalar, vec or marray result */
+template <typename T>
+struct result_element_count : std::integral_constant<size_t, 1> {};
+
+template <typename T, int N>
+struct result_element_count<sycl::vec<T, N>>
+    : std::integral_constant<size_t, N> {};
+
+template <typename T, size_t N>
+struct result_element_count<sycl::marray<T, N>>
+    : std::integral_constant<size_t, N> {};
+
+/** Reference result of a math function, with the set of its elements that
+ *  are undefined according to the specification. The set is a fixed-size
+ *  bitmask, so reference results never allocate.
+ */
 template <typename returnT> struct resultRef {
+  using undefined_set = std::bitset<result_element_count<returnT>::value>;
+
   returnT res;
-  std::map<int, bool> undefined;
+  undefined_set undefined;
 
   template <typename U>
-  resultRef(U res_t, std::map<int, bool> und_t)
-      : res(res_t), undefined(und_t) {}
+  resultRef(U res_t, undefined_set und_t) : res(res_t), undefined(und_t) {}
 
   template <typename U>
-  resultRef(U res_t, bool und_t)
-      : res(res_t), undefined({{0, und_t}}) {}
+  resultRef(U res_t, bool und_t) : res(res_t), undefined(und_t ? 1 : 0) {}
 
   template <typename U> resultRef(U res_t) : res(res_t) {}
 
+  resultRef() = default;
+
   template <class U>
   resultRef(const resultRef<U> &other)
-      : res(other.res), undefined(other.undefined) {}
+      : res(other.res), undefined(other.undefined.to_ullong()) {}
 };
 
 namespace math {
@@ -137,14 +157,13 @@ template <typename T, int N, typename funT, typename... Args>
 sycl_cts::resultRef<sycl::vec<T, N>>
 run_func_on_vector_result_ref(funT fun, Args... args) {
   sycl::vec<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (int i = 0; i < N; i++) {
-    undefined[i] = false;
     resultRef<T> element = fun(getElement(args, i)...);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       setElement<T, N>(res, i, element.res);
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::vec<T, N>>(res, undefined);
 }
@@ -153,13 +172,13 @@ template <typename T, size_t N, typename funT, typename... Args>
 sycl_cts::resultRef<sycl::marray<T, N>> run_func_on_marray_result_ref(
     funT fun, Args... args) {
   sycl::marray<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (size_t i = 0; i < N; i++) {
     resultRef<T> element = fun(getElement(args, i)...);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::marray<T, N>>(res, undefined);
 }
@@ -867,13 +867,13 @@ sycl_cts::resultRef<sycl::vec<T, N>> clamp(sycl::vec<T, N> a, sycl::vec<T, N> b,
 template <typename T, int N>
 sycl_cts::resultRef<sycl::vec<T, N>> clamp(sycl::vec<T, N> a, T b, T c) {
   sycl::vec<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (int i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = clamp(a[i], b, c);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::vec<T, N>>(res, undefined);
 }
@@ -945,13 +945,13 @@ template <typename T, int N>
 sycl_cts::resultRef<sycl::vec<T, N>> mix(sycl::vec<T, N> a, sycl::vec<T, N> b,
                                          T c) {
   sycl::vec<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (int i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = mix(a[i], b[i], c);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::vec<T, N>>(res, undefined);
 }
@@ -977,13 +977,13 @@ sycl_cts::resultRef<sycl::vec<T, N>> smoothstep(sycl::vec<T, N> a,
 template <typename T, int N>
 sycl_cts::resultRef<sycl::vec<T, N>> smoothstep(T a, T b, sycl::vec<T, N> c) {
   sycl::vec<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (int i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = smoothstep(a, b, c[i]);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::vec<T, N>>(res, undefined);
 }
@@ -1297,13 +1297,13 @@ sycl_cts::resultRef<sycl::marray<T, N>> clamp(sycl::marray<T, N> a,
 template <typename T, size_t N>
 sycl_cts::resultRef<sycl::marray<T, N>> clamp(sycl::marray<T, N> a, T b, T c) {
   sycl::marray<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (size_t i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = clamp(a[i], b, c);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::marray<T, N>>(res, undefined);
 }
@@ -1380,13 +1380,13 @@ template <typename T, size_t N>
 sycl_cts::resultRef<sycl::marray<T, N>> mix(sycl::marray<T, N> a,
                                             sycl::marray<T, N> b, T c) {
   sycl::marray<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (size_t i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = mix(a[i], b[i], c);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::marray<T, N>>(res, undefined);
 }
@@ -1413,13 +1413,13 @@ template <typename T, size_t N>
 sycl_cts::resultRef<sycl::marray<T, N>> smoothstep(T a, T b,
                                                    sycl::marray<T, N> c) {
   sycl::marray<T, N> res;
-  std::map<int, bool> undefined;
+  std::bitset<N> undefined;
   for (size_t i = 0; i < N; i++) {
     sycl_cts::resultRef<T> element = smoothstep(a, b, c[i]);
-    if (element.undefined.empty())
+    if (element.undefined.none())
       res[i] = element.res;
     else
-      undefined[i] = true;
+      undefined.set(i);
   }
   return sycl_cts::resultRef<sycl::marray<T, N>>(res, undefined);
 }
@@ -0,0 +1,75 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Batched evaluation of math reference functions
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
+#define __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
+
+#include "host_thread_pool.h"
+#include "math_reference.h"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sycl_cts {
+namespace math {
+
+/**
+ * @brief Evaluates a reference function for every element of the given input
+ *        arrays, using all threads of the host thread pool
+ *
+ * Writes `ref(args[i]...)` to `results[i]` for every i in [0, count). Each
+ * element is computed exactly as a single call of the reference function on
+ * the calling thread would compute it, so the results do not depend on the
+ * number of threads. The loop over each chunk is kept free of any other work,
+ * which allows the compiler to vectorize inlined reference functions.
+ *
+ * @param ref Reference function, e.g. `[](auto x) { return reference::sin(x);
+ *        }`. Called concurrently, so it must not modify shared state.
+ */
+template <typename ResultT, typename RefFuncT, typename... ArgsT>
+void evaluate_reference_batch(const RefFuncT& ref, std::size_t count,
+                              ResultT* results, const ArgsT*... args) {
+  util::get<util::host_thread_pool>().parallel_for(
+      count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          results[i] = ref(args[i]...);
+        }
+      });
+}
+
+/**
+ * @brief Evaluates a reference function for every element of the given input
+ *        vectors, which all need to have the same size
+ * @return Vector with the result of each reference function call
+ */
+template <typename RefFuncT, typename... ArgsT>
+auto evaluate_reference_batch(const RefFuncT& ref,
+                              const std::vector<ArgsT>&... args) {
+  using result_t = std::invoke_result_t<const RefFuncT&, const ArgsT&...>;
+  static_assert(sizeof...(ArgsT) > 0, "At least one input is required");
+
+  const std::size_t sizes[] = {args.size()...};
+  for (const auto size : sizes) {
+    assert(size == sizes[0] && "Input sizes differ");
+    static_cast<void>(size);
+  }
+
+  std::vector<result_t> results(sizes[0]);
+  evaluate_reference_batch(ref, sizes[0], results.data(), args.data()...);
+  return results;
+}
+
+}  // namespace math
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_MATH_REFERENCE_BATCH_H
@@ -0,0 +1,268 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "math_reference_simd.h"
+#include "../oclmath/Utility.h"
+#include "../oclmath/reference_math.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+// The vectorized code paths use AVX and FMA instructions, selected at runtime
+// depending on the host CPU, so that the CTS does not need to be built for a
+// specific instruction set
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__)) &&  \
+    !defined(__SYCL_DEVICE_ONLY__)
+#define SYCL_CTS_SIMD_REFERENCE_X86 1
+#include <immintrin.h>
+#else
+#define SYCL_CTS_SIMD_REFERENCE_X86 0
+#endif
+
+namespace sycl_cts {
+namespace math {
+
+namespace {
+
+/** Number of pseudo-random inputs each vectorized function is validated on */
+constexpr std::size_t validation_input_count = std::size_t{1} << 16;
+
+constexpr std::size_t simd_reference_count =
+    static_cast<std::size_t>(simd_reference::fma) + 1;
+
+/** Inputs that the vectorized square root computes like std::sqrt */
+bool accepts_sqrt(float x) {
+  // False for NaNs, whose payload and sign depend on the libm implementation
+  return x >= 0.0f;
+}
+
+/** Inputs for which reference_fma takes its exact code path */
+bool accepts_fma(float a, float b, float c) {
+  return std::isfinite(a) && std::isfinite(b) && std::isfinite(c) &&
+         a != 0.0f && b != 0.0f && c != 0.0f && !gIsInRTZMode;
+}
+
+void sqrt_scalar(const float* x, double* results, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) results[i] = reference_sqrt(x[i]);
+}
+
+void rsqrt_scalar(const float* x, double* results, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) results[i] = reference_rsqrt(x[i]);
+}
+
+void fma_scalar(const float* a, const float* b, const float* c,
+                double* results, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i)
+    results[i] = reference_fma(a[i], b[i], c[i], 0);
+}
+
+#if SYCL_CTS_SIMD_REFERENCE_X86
+
+__attribute__((target("avx"))) void sqrt_avx(const float* x, double* results,
+                                              std::size_t count) {
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d value = _mm256_cvtps_pd(_mm_loadu_ps(x + i));
+    _mm256_storeu_pd(results + i, _mm256_sqrt_pd(value));
+  }
+  sqrt_scalar(x + i, results + i, count - i);
+}
+
+__attribute__((target("avx"))) void rsqrt_avx(const float* x, double* results,
+                                               std::size_t count) {
+  const __m256d one = _mm256_set1_pd(1.0);
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d value = _mm256_cvtps_pd(_mm_loadu_ps(x + i));
+    _mm256_storeu_pd(results + i, _mm256_div_pd(one, _mm256_sqrt_pd(value)));
+  }
+  rsqrt_scalar(x + i, results + i, count - i);
+}
+
+__attribute__((target("avx,fma"))) void fma_avx(const float* a,
+                                                 const float* b,
+                                                 const float* c,
+                                                 double* results,
+                                                 std::size_t count) {
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 value =
+        _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i),
+                        _mm256_loadu_ps(c + i));
+    _mm256_storeu_pd(results + i,
+                     _mm256_cvtps_pd(_mm256_castps256_ps128(value)));
+    _mm256_storeu_pd(results + i + 4,
+                     _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+  }
+  fma_scalar(a + i, b + i, c + i, results + i, count - i);
+}
+
+bool host_supports(simd_reference function) {
+  switch (function) {
+    case simd_reference::sqrt:
+    case simd_reference::rsqrt:
+      return __builtin_cpu_supports("avx");
+    case simd_reference::fma:
+      return __builtin_cpu_supports("avx") && __builtin_cpu_supports("fma");
+    default:
+      return false;
+  }
+}
+
+#else
+
+bool host_supports(simd_reference) { return false; }
+
+#endif  // SYCL_CTS_SIMD_REFERENCE_X86
+
+// The vectorized versions below are only called once host_supports() has
+// confirmed the required instructions
+
+void sqrt_simd(const float* x, double* results, std::size_t count) {
+#if SYCL_CTS_SIMD_REFERENCE_X86
+  sqrt_avx(x, results, count);
+#endif
+  for (std::size_t i = 0; i < count; ++i)
+    if (!accepts_sqrt(x[i])) results[i] = reference_sqrt(x[i]);
+}
+
+void rsqrt_simd(const float* x, double* results, std::size_t count) {
+#if SYCL_CTS_SIMD_REFERENCE_X86
+  rsqrt_avx(x, results, count);
+#endif
+  for (std::size_t i = 0; i < count; ++i)
+    if (!accepts_sqrt(x[i])) results[i] = reference_rsqrt(x[i]);
+}
+
+void fma_simd(const float* a, const float* b, const float* c, double* results,
+              std::size_t count) {
+#if SYCL_CTS_SIMD_REFERENCE_X86
+  fma_avx(a, b, c, results, count);
+#endif
+  for (std::size_t i = 0; i < count; ++i)
+    if (!accepts_fma(a[i], b[i], c[i]))
+      results[i] = reference_fma(a[i], b[i], c[i], 0);
+}
+
+/**
+ * @brief Special values followed by pseudo-random bit patterns covering all
+ *        exponents, signs, subnormals and NaNs
+ */
+std::vector<float> get_validation_inputs() {
+  const float specials[] = {0.0f,
+                            -0.0f,
+                            1.0f,
+                            -1.0f,
+                            0.5f,
+                            2.0f,
+                            INFINITY,
+                            -INFINITY,
+                            NAN,
+                            -NAN,
+                            FLT_MIN,
+                            -FLT_MIN,
+                            FLT_MAX,
+                            -FLT_MAX,
+                            FLT_EPSILON,
+                            0x1p-149f,
+                            -0x1p-149f,
+                            0x1.fffffcp-127f};
+  std::vector<float> inputs(std::begin(specials), std::end(specials));
+  inputs.reserve(inputs.size() + validation_input_count);
+  for (std::uint32_t i = 0; i < validation_input_count; ++i) {
+    const std::uint32_t bits = i * 0x9e3779b9u;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    inputs.push_back(value);
+  }
+  return inputs;
+}
+
+template <typename T>
+bool bit_identical(const std::vector<T>& a, const std::vector<T>& b) {
+  return std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+/**
+ * @brief Compares the vectorized version of a function to the scalar
+ *        reference for all validation inputs
+ */
+bool validate(simd_reference function) {
+  const auto x = get_validation_inputs();
+  const std::size_t count = x.size();
+  std::vector<double> expected(count), actual(count);
+  switch (function) {
+    case simd_reference::sqrt:
+      sqrt_scalar(x.data(), expected.data(), count);
+      sqrt_simd(x.data(), actual.data(), count);
+      break;
+    case simd_reference::rsqrt:
+      rsqrt_scalar(x.data(), expected.data(), count);
+      rsqrt_simd(x.data(), actual.data(), count);
+      break;
+    case simd_reference::fma: {
+      // Combine every input with two others, using rotated copies
+      std::vector<float> b(x.begin() + 1, x.end());
+      b.push_back(x.front());
+      std::vector<float> c(x.rbegin(), x.rend());
+      fma_scalar(x.data(), b.data(), c.data(), expected.data(), count);
+      fma_simd(x.data(), b.data(), c.data(), actual.data(), count);
+      break;
+    }
+  }
+  return bit_identical(expected, actual);
+}
+
+}  // namespace
+
+bool is_simd_reference_vectorized(simd_reference function) {
+  struct state {
+    std::once_flag validated;
+    bool vectorized = false;
+  };
+  static state states[simd_reference_count];
+
+  auto& s = states[static_cast<std::size_t>(function)];
+  std::call_once(s.validated, [&] {
+    s.vectorized = host_supports(function) && validate(function);
+  });
+  return s.vectorized;
+}
+
+void reference_sqrt_batch(const float* x, double* results, std::size_t count) {
+  if (is_simd_reference_vectorized(simd_reference::sqrt))
+    sqrt_simd(x, results, count);
+  else
+    sqrt_scalar(x, results, count);
+}
+
+void reference_rsqrt_batch(const float* x, double* results,
+                           std::size_t count) {
+  if (is_simd_reference_vectorized(simd_reference::rsqrt))
+    rsqrt_simd(x, results, count);
+  else
+    rsqrt_scalar(x, results, count);
+}
+
+void reference_fma_batch(const float* a, const float* b, const float* c,
+                         double* results, std::size_t count) {
+  if (is_simd_reference_vectorized(simd_reference::fma))
+    fma_simd(a, b, c, results, count);
+  else
+    fma_scalar(a, b, c, results, count);
+}
+
+}  // namespace math
+}  // namespace sycl_cts
@@ -0,0 +1,55 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Vectorized evaluation of oclmath reference functions over arrays
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_MATH_REFERENCE_SIMD_H
+#define __SYCLCTS_UTIL_MATH_REFERENCE_SIMD_H
+
+#include <cstddef>
+
+namespace sycl_cts {
+namespace math {
+
+/** oclmath reference functions with an array version */
+enum class simd_reference { sqrt, rsqrt, fma };
+
+/**
+ * @brief Whether the array version of the given reference function uses a
+ *        vectorized code path on this host
+ *
+ * A vectorized code path is only used if the host supports the required
+ * instructions and if it produces results bit-identical to the scalar
+ * reference function. The latter is validated once per process on a set of
+ * special and pseudo-random inputs when a function is first used. Functions
+ * failing the validation permanently fall back to the scalar reference.
+ */
+bool is_simd_reference_vectorized(simd_reference function);
+
+/**
+ * @name Array versions of the oclmath reference functions
+ *
+ * Each function writes `reference_<name>(x[i]...)` to `results[i]` for every
+ * i in [0, count). Inputs the vectorized code path does not handle in the same
+ * way as the scalar reference, like NaNs or negative square roots, are always
+ * computed by the scalar reference. None of the functions allocate, so they
+ * can be called concurrently on disjoint ranges, e.g. from
+ * util::host_thread_pool::parallel_for().
+ * @{
+ */
+void reference_sqrt_batch(const float* x, double* results, std::size_t count);
+void reference_rsqrt_batch(const float* x, double* results, std::size_t count);
+void reference_fma_batch(const float* a, const float* b, const float* c,
+                         double* results, std::size_t count);
+/** @} */
+
+}  // namespace math
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_MATH_REFERENCE_SIMD_H
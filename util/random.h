@@ -0,0 +1,147 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Reproducible parallel generation of random test inputs
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_RANDOM_H
+#define __SYCLCTS_UTIL_RANDOM_H
+
+#include "host_thread_pool.h"
+#include "singleton.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Seed of all random test inputs, set using the `--seed` CLI parameter. The
+ * default is fixed, so that every run uses the same inputs unless a seed is
+ * given explicitly.
+ */
+class random_config : public singleton<random_config> {
+ public:
+  std::uint64_t get_seed() const { return seed; }
+  void set_seed(std::uint64_t value) { seed = value; }
+
+ private:
+  std::uint64_t seed = 0;
+};
+
+/**
+ * @brief Counter-based random number generator (Philox4x32-10)
+ *
+ * Every value is a pure function of the seed, the stream and the index of the
+ * value, so any element of a sequence can be computed without computing the
+ * ones before it. This allows filling large buffers from many host threads or
+ * work-items with results that do not depend on how the work is distributed.
+ * Independent sequences, e.g. one per test case or kernel argument, are
+ * selected by the stream. The generator is trivially copyable and can be
+ * captured by kernels.
+ */
+class counter_rng {
+ public:
+  constexpr counter_rng(std::uint64_t seed, std::uint64_t stream = 0)
+      : seed(seed), stream(stream) {}
+
+  /** Creates a generator for the given stream using the `--seed` seed */
+  static counter_rng from_config(std::uint64_t stream = 0) {
+    return counter_rng{get<random_config>().get_seed(), stream};
+  }
+
+  /** Random 32 bit value with the given index */
+  constexpr std::uint32_t uint32(std::uint64_t index) const {
+    const block b = generate(index / 4);
+    return b.values[index % 4];
+  }
+
+  /** Random 64 bit value with the given index */
+  constexpr std::uint64_t uint64(std::uint64_t index) const {
+    const block b = generate(index / 2);
+    const std::size_t lane = static_cast<std::size_t>(index % 2) * 2;
+    return (static_cast<std::uint64_t>(b.values[lane]) << 32) |
+           b.values[lane + 1];
+  }
+
+  /** Uniformly distributed float in [0, 1) with the given index */
+  constexpr float uniform_float(std::uint64_t index) const {
+    return static_cast<float>(uint32(index) >> 8) * 0x1p-24f;
+  }
+
+  /** Uniformly distributed double in [0, 1) with the given index */
+  constexpr double uniform_double(std::uint64_t index) const {
+    return static_cast<double>(uint64(index) >> 11) * 0x1p-53;
+  }
+
+ private:
+  struct block {
+    std::uint32_t values[4];
+  };
+
+  /** Four random 32 bit values for the given counter */
+  constexpr block generate(std::uint64_t counter) const {
+    std::uint32_t c[4] = {static_cast<std::uint32_t>(counter),
+                          static_cast<std::uint32_t>(counter >> 32),
+                          static_cast<std::uint32_t>(stream),
+                          static_cast<std::uint32_t>(stream >> 32)};
+    std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+    for (int round = 0; round < 10; ++round) {
+      const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * c[0];
+      const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * c[2];
+      const std::uint32_t next[4] = {
+          static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k0,
+          static_cast<std::uint32_t>(p1),
+          static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k1,
+          static_cast<std::uint32_t>(p0)};
+      for (int i = 0; i < 4; ++i) c[i] = next[i];
+      k0 += 0x9E3779B9u;
+      k1 += 0xBB67AE85u;
+    }
+    return block{{c[0], c[1], c[2], c[3]}};
+  }
+
+  std::uint64_t seed;
+  std::uint64_t stream;
+};
+
+/**
+ * @brief Fills `data` with random bit patterns on all threads of the host
+ *        thread pool
+ *
+ * Element i consists of the 32 bit values with indices starting at
+ * `i * ceil(sizeof(T) / 4)`, so a kernel can compute the same element using
+ * the same generator. The result does not depend on the number of threads.
+ * For floating-point types all exponents, subnormals, infinities and NaNs are
+ * generated.
+ */
+template <typename T>
+void fill_random_bits(const counter_rng& rng, T* data, std::size_t count) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Random bit patterns require a trivially copyable type");
+  constexpr std::size_t words = (sizeof(T) + 3) / 4;
+  get<host_thread_pool>().parallel_for(
+      count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          std::uint32_t bits[words];
+          for (std::size_t w = 0; w < words; ++w) {
+            bits[w] = rng.uint32(static_cast<std::uint64_t>(i) * words + w);
+          }
+          std::memcpy(data + i, bits, sizeof(T));
+        }
+      });
+}
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_RANDOM_H
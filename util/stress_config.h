@@ -0,0 +1,61 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Tunable load parameters of stress tests
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_STRESS_CONFIG_H
+#define __SYCLCTS_UTIL_STRESS_CONFIG_H
+
+#include "singleton.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Load parameters of stress tests, set using the `--stress-*` CLI parameters.
+ * The defaults keep stress tests short enough for conformance runs.
+ */
+class stress_config : public singleton<stress_config> {
+ public:
+  /** Number of memory locations all contended operations are spread over */
+  std::size_t get_hot_spots() const { return hot_spots; }
+  void set_hot_spots(std::size_t count) { hot_spots = count; }
+
+  /**
+   * Fraction of operations in [0, 1] that target a hot spot instead of a
+   * location private to the work-item
+   */
+  double get_contention() const { return contention; }
+  void set_contention(double ratio) { contention = ratio; }
+
+  /** Number of operations performed by each work-item per kernel launch */
+  std::size_t get_iterations() const { return iterations; }
+  void set_iterations(std::size_t count) { iterations = count; }
+
+  /**
+   * Minimum time kernels are launched repeatedly for. With a duration of zero,
+   * each kernel is launched once.
+   */
+  std::chrono::milliseconds get_duration() const { return duration; }
+  void set_duration(std::chrono::milliseconds time) { duration = time; }
+
+ private:
+  std::size_t hot_spots = 1;
+  double contention = 1.0;
+  std::size_t iterations = 64;
+  std::chrono::milliseconds duration{0};
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_STRESS_CONFIG_H
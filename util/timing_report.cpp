@@ -0,0 +1,264 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+*******************************************************************************/
+
+#include "timing_report.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace sycl_cts {
+namespace util {
+
+static std::string escape_json(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          result += buffer;
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+
+namespace {
+
+/**
+ * Minimal reader for the list of flat JSON objects written by
+ * timing_report::write(). All values are returned as strings.
+ */
+class json_object_reader {
+ public:
+  explicit json_object_reader(std::string text) : text(std::move(text)) {}
+
+  bool next(std::map<std::string, std::string>& object) {
+    object.clear();
+    pos = text.find('{', pos);
+    if (pos == std::string::npos) return false;
+    ++pos;
+    while (skip_whitespace() && text[pos] != '}') {
+      const auto key = read_string();
+      if (!skip_whitespace() || text[pos] != ':') return false;
+      ++pos;
+      if (!skip_whitespace()) return false;
+      object[key] = text[pos] == '"' ? read_string() : read_literal();
+      if (skip_whitespace() && text[pos] == ',') ++pos;
+    }
+    ++pos;
+    return true;
+  }
+
+ private:
+  bool skip_whitespace() {
+    while (pos < text.size() &&
+           std::isspace(static_cast<unsigned char>(text[pos]))) {
+      ++pos;
+    }
+    return pos < text.size();
+  }
+
+  std::string read_string() {
+    std::string result;
+    if (text[pos] != '"') return result;
+    for (++pos; pos < text.size() && text[pos] != '"'; ++pos) {
+      if (text[pos] == '\\' && pos + 1 < text.size()) {
+        ++pos;
+        switch (text[pos]) {
+          case 'n':
+            result += '\n';
+            break;
+          case 't':
+            result += '\t';
+            break;
+          case 'u':
+            result += static_cast<char>(
+                std::strtol(text.substr(pos + 1, 4).c_str(), nullptr, 16));
+            pos += 4;
+            break;
+          default:
+            result += text[pos];
+        }
+      } else {
+        result += text[pos];
+      }
+    }
+    ++pos;
+    return result;
+  }
+
+  std::string read_literal() {
+    const auto start = pos;
+    while (pos < text.size() && text[pos] != ',' && text[pos] != '}' &&
+           !std::isspace(static_cast<unsigned char>(text[pos]))) {
+      ++pos;
+    }
+    return text.substr(start, pos - start);
+  }
+
+  std::string text;
+  std::size_t pos = 0;
+};
+
+}  // namespace
+
+void timing_report::begin_section(const std::string& name) {
+  open_scopes.push_back(scope{name, clock::now()});
+}
+
+void timing_report::end_section() {
+  if (open_scopes.empty()) return;
+  const auto end = clock::now();
+  scope& current = open_scopes.back();
+
+  // The outermost scope is the test case itself, all others form the path of
+  // the section within that test case.
+  std::string section;
+  for (std::size_t i = 1; i < open_scopes.size(); ++i) {
+    if (i > 1) section += " / ";
+    section += open_scopes[i].name;
+  }
+
+  entry& result = get_entry(open_scopes.front().name, section);
+  result.wall_time +=
+      std::chrono::duration<double>(end - current.start).count();
+  result.submissions += current.submissions;
+  for (const auto& event : current.profiled_events) {
+    // Blocks until the profiling information is available
+    const auto start = event.get_profiling_info<
+        sycl::info::event_profiling::command_start>();
+    const auto finish =
+        event.get_profiling_info<sycl::info::event_profiling::command_end>();
+    result.has_device_time = true;
+    result.device_time += (finish - start) * 1e-9;
+  }
+
+  open_scopes.pop_back();
+}
+
+void timing_report::record_submission(const sycl::queue& queue,
+                                      const sycl::event& event) {
+  if (!is_enabled()) return;
+  const bool profiling =
+      device_time &&
+      queue.has_property<sycl::property::queue::enable_profiling>();
+  for (auto& open_scope : open_scopes) {
+    ++open_scope.submissions;
+    if (profiling) open_scope.profiled_events.push_back(event);
+  }
+}
+
+timing_report::entry& timing_report::get_entry(const std::string& test_case,
+                                               const std::string& section) {
+  for (auto& existing : entries) {
+    if (existing.test_case == test_case && existing.section == section) {
+      return existing;
+    }
+  }
+  entries.push_back(entry{test_case, section});
+  return entries.back();
+}
+
+void timing_report::write() const {
+  std::fstream reportFile(output_file, std::ios::out);
+
+  reportFile << "[";
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    const auto& e = entries[i];
+    reportFile << (i > 0 ? ",\n " : "\n ") << "{\"test-case\": \""
+               << escape_json(e.test_case) << "\", \"section\": \""
+               << escape_json(e.section) << "\", \"wall-time\": " << e.wall_time
+               << ", \"submissions\": " << e.submissions;
+    if (e.has_device_time) {
+      reportFile << ", \"device-time\": " << e.device_time;
+    }
+    reportFile << "}";
+  }
+  reportFile << "\n]\n";
+}
+
+std::map<std::string, double> timing_report::read_test_case_times(
+    const std::string& file) {
+  std::map<std::string, double> times;
+  std::ifstream reportFile(file);
+  if (!reportFile) return times;
+
+  std::stringstream content;
+  content << reportFile.rdbuf();
+  json_object_reader reader(content.str());
+  std::map<std::string, std::string> object;
+  while (reader.next(object)) {
+    // Entries without a section hold the time of the entire test case
+    if (object.count("test-case") == 0 || object.count("wall-time") == 0 ||
+        !object["section"].empty()) {
+      continue;
+    }
+    times[object["test-case"]] = std::atof(object["wall-time"].c_str());
+  }
+  return times;
+}
+
+void timing_report::merge(const std::vector<std::string>& files,
+                          const std::string& output_file) {
+  std::string entries;
+  for (const auto& file : files) {
+    std::ifstream reportFile(file);
+    if (!reportFile) continue;
+    std::stringstream content;
+    content << reportFile.rdbuf();
+    reportFile.close();
+    std::remove(file.c_str());
+
+    // Each report is a JSON array, only the entries between the brackets are
+    // kept
+    const std::string text = content.str();
+    const auto first = text.find('[');
+    const auto last = text.rfind(']');
+    if (first == std::string::npos || last == std::string::npos ||
+        last < first) {
+      continue;
+    }
+    auto is_space = [&](std::size_t i) {
+      return std::isspace(static_cast<unsigned char>(text[i])) != 0;
+    };
+    auto begin = first + 1;
+    auto end = last;
+    while (begin < end && is_space(begin)) ++begin;
+    while (end > begin && is_space(end - 1)) --end;
+    if (begin == end) continue;
+    entries += entries.empty() ? "\n " : ",\n ";
+    entries += text.substr(begin, end - begin);
+  }
+
+  std::fstream reportFile(output_file, std::ios::out);
+  reportFile << "[" << entries << "\n]\n";
+}
+
+}  // namespace util
+}  // namespace sycl_cts
@@ -0,0 +1,130 @@
+/*******************************************************************************
+//
+//  SPDX-FileCopyrightText: 2026 The Khronos Group Inc.
+//  SPDX-License-Identifier: Apache-2.0
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Per test case and per section timing instrumentation
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_TIMING_REPORT_H
+#define __SYCLCTS_UTIL_TIMING_REPORT_H
+
+#include "singleton.h"
+
+#include <sycl/sycl.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Collects wall-clock time, the number of submitted commands and the device
+ * execution time of every test case and section executed during a CTS run.
+ * Enabled by the `--timing-report` CLI parameter.
+ */
+class timing_report : public singleton<timing_report> {
+ public:
+  void set_output_file(std::string file) { output_file = std::move(file); }
+
+  bool is_enabled() const { return !output_file.empty(); }
+
+  /**
+   * Whether the queue of each test unit is created with profiling enabled, so
+   * that the device execution time of recorded commands is reported. Set using
+   * the `--timing-device-time` CLI parameter, off by default as it changes the
+   * configuration of the queue under test and keeps all recorded events alive
+   * until the end of their section.
+   */
+  bool is_device_time_enabled() const { return is_enabled() && device_time; }
+  void set_device_time(bool enabled) { device_time = enabled; }
+
+  /**
+   * Opens a new timing scope. The outermost scope corresponds to a test case,
+   * nested scopes correspond to its sections.
+   */
+  void begin_section(const std::string& name);
+
+  /**
+   * Closes the innermost timing scope and accumulates its results. Sections
+   * entered multiple times (e.g. once per leaf section) are merged.
+   */
+  void end_section();
+
+  /**
+   * Records a command submitted to the given queue within all open scopes.
+   * If device time is enabled and the queue was created with
+   * `property::queue::enable_profiling`, the device execution time of the
+   * command is added to the report as well.
+   */
+  void record_submission(const sycl::queue& queue, const sycl::event& event);
+
+  /**
+   * Writes all collected results as JSON to the output file.
+   */
+  void write() const;
+
+  /**
+   * Reads the total wall-clock time per test case from a report written by a
+   * previous run. Returns an empty map if the file does not exist.
+   */
+  static std::map<std::string, double> read_test_case_times(
+      const std::string& file);
+
+  /**
+   * Combines the entries of reports written by other processes into a single
+   * report and removes them. Missing reports are ignored.
+   */
+  static void merge(const std::vector<std::string>& files,
+                    const std::string& output_file);
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  struct scope {
+    std::string name;
+    clock::time_point start;
+    std::size_t submissions = 0;
+    std::vector<sycl::event> profiled_events;
+  };
+
+  struct entry {
+    std::string test_case;
+    std::string section;
+    double wall_time = 0;
+    std::size_t submissions = 0;
+    bool has_device_time = false;
+    double device_time = 0;
+  };
+
+  entry& get_entry(const std::string& test_case, const std::string& section);
+
+  std::string output_file;
+  bool device_time = false;
+  std::vector<scope> open_scopes;
+  std::vector<entry> entries;
+};
+
+/**
+ * @brief Submits a command group to the queue and records it in the timing
+ *        report
+ */
+template <typename CommandGroupT>
+sycl::event submit_and_record(sycl::queue& queue, CommandGroupT&& cgf) {
+  sycl::event event = queue.submit(std::forward<CommandGroupT>(cgf));
+  get<timing_report>().record_submission(queue, event);
+  return event;
+}
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_TIMING_REPORT_H